@@ -5,7 +5,7 @@
 # Platform: Linux/Clang/64/d
 
 # Variables
-CXXFLAGS := -pipe -std=c++11 -pedantic -Wall -Wextra -Wno-unused-parameter -Wno-unused-variable -Wno-unused-label -Wno-unused-function -Wno-unknown-pragmas -ffor-scope -m64 -march=native -fno-omit-frame-pointer -pthread -O0 -ggdb
+CXXFLAGS := -pipe -std=c++11 -pedantic -Wall -Wextra -Wno-unused-parameter -Wno-unused-variable -Wno-unused-label -Wno-unused-function -Wno-unknown-pragmas -ffor-scope -m64 -march=native -fno-omit-frame-pointer -pthread -O0 -ggdb -DQSS_DIAGNOSTICS
 CFLAGS := -pipe -std=c99 -pedantic -Wall -Wextra -Wno-unused-parameter -Wno-unused-variable -Wno-unused-label -Wno-unused-function -Wno-unknown-pragmas -Wno-sign-compare -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast -m64 -march=native -fno-omit-frame-pointer -pthread -O0 -ggdb
 LDFLAGS := -pipe -Wall -ggdb
 
@@ -5,7 +5,7 @@
 # Platform: Windows/VC/64/d
 
 # Variables
-CXXFLAGS := /nologo /TP /EHsc /W3 /wd4068 /wd4244 /wd4258 /wd4996 /DNOMINMAX /DWIN32_LEAN_AND_MEAN /DWIN32 /DFMILIB_STATIC_LIB_ONLY /Od /Ob0 /Z7 /RTCsu /MD
+CXXFLAGS := /nologo /TP /EHsc /W3 /wd4068 /wd4244 /wd4258 /wd4996 /DNOMINMAX /DWIN32_LEAN_AND_MEAN /DWIN32 /DFMILIB_STATIC_LIB_ONLY /Od /Ob0 /Z7 /RTCsu /MD /DQSS_DIAGNOSTICS
 CFLAGS := /nologo /TC /W3 /wd4068 /wd4244 /wd4996 /DWIN32_LEAN_AND_MEAN /DWIN32 /DFMILIB_STATIC_LIB_ONLY /Od /Ob0 /Z7 /RTCsu /MD
 # Disabled Warnings:
 #  4068 Unknown pragma
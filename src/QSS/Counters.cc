@@ -0,0 +1,237 @@
+// QSS Hardware Performance Counters by Solver Phase
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Counters.hh>
+
+// C++ Headers
+#include <iomanip>
+#include <iostream>
+#ifdef __linux__
+#include <cstring>
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace counters {
+
+namespace { // Internal
+
+// Phase Names
+char const * const phase_names[ n_phases ] = {
+ "other",
+ "queue",
+ "derivative",
+ "root",
+ "output"
+};
+
+// Event Names
+char const * const event_names[ n_events ] = {
+ "cycles",
+ "instructions",
+ "L1D_misses",
+ "LLC_misses",
+ "branch_misses",
+ "dTLB_misses",
+ "task_clock_ns"
+};
+
+#ifdef __linux__
+
+// Event Type, Config, and Sample Period: Periods are prime to avoid aliasing with loop periodicities
+struct Event_Spec
+{
+	std::uint32_t type;
+	std::uint64_t config;
+	std::uint64_t period;
+};
+std::uint64_t const cache_read_miss( ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ) );
+Event_Spec const specs[ n_events ] = {
+ { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, 2000003u },
+ { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, 2000003u },
+ { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | cache_read_miss, 20011u },
+ { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, 2003u },
+ { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, 20011u },
+ { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | cache_read_miss, 2003u },
+ { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK, 100003u } // ns
+};
+
+// Counting State
+int fds[ n_events ] = { -1, -1, -1, -1, -1, -1, -1 }; // Counter file descriptors
+Counts counts; // Samples while counting
+
+// Overflow Signal
+int
+overflow_signal()
+{
+	return SIGRTMIN + 1;
+}
+
+// Counter Overflow Handler: Credits a sample period to the current phase and rearms the counter
+void
+on_overflow( int, siginfo_t * info, void * )
+{
+	for ( size_type e = 0; e < n_events; ++e ) {
+		if ( fds[ e ] == info->si_fd ) {
+			++counts.samples[ size_type( phase ) ][ e ];
+			ioctl( fds[ e ], PERF_EVENT_IOC_REFRESH, 1 );
+			return;
+		}
+	}
+}
+
+// Open a Sampling Counter Signaling This Thread: Returns File Descriptor or -1
+int
+open_counter( Event_Spec const & spec )
+{
+	perf_event_attr attr;
+	std::memset( &attr, 0, sizeof( attr ) );
+	attr.size = sizeof( attr );
+	attr.type = spec.type;
+	attr.config = spec.config;
+	attr.sample_period = spec.period;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.wakeup_events = 1;
+	int const fd( int( syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 ) ) );
+	if ( fd < 0 ) return -1;
+	f_owner_ex owner;
+	owner.type = F_OWNER_TID;
+	owner.pid = pid_t( syscall( SYS_gettid ) );
+	if ( ( fcntl( fd, F_SETFL, O_ASYNC ) == -1 ) || ( fcntl( fd, F_SETSIG, overflow_signal() ) == -1 ) || ( fcntl( fd, F_SETOWN_EX, &owner ) == -1 ) ) {
+		close( fd );
+		return -1;
+	}
+	return fd;
+}
+
+#endif
+
+} // Internal
+
+// Current Phase of This Thread
+thread_local volatile std::sig_atomic_t phase( Other );
+
+// Phase Estimate of an Event
+double
+Counts::
+operator ()( Phase const p, Event const e ) const
+{
+	std::uint64_t n( 0u );
+	for ( size_type i = 0; i < n_phases; ++i ) n += samples[ i ][ e ];
+	if ( n == 0u ) return ( p == Other ? total[ e ] : 0.0 ); // Too few events for a sample
+	return total[ e ] * ( double( samples[ p ][ e ] ) / double( n ) );
+}
+
+// Phase Name
+char const *
+name( Phase const p )
+{
+	return phase_names[ p ];
+}
+
+// Event Name
+char const *
+name( Event const e )
+{
+	return event_names[ e ];
+}
+
+// Start Counting on This Thread: Returns Whether Any Counter Opened
+bool
+start()
+{
+#ifdef __linux__
+	counts = Counts();
+	struct sigaction action;
+	std::memset( &action, 0, sizeof( action ) );
+	action.sa_sigaction = on_overflow;
+	action.sa_flags = SA_SIGINFO | SA_RESTART; // Restart solver I/O interrupted by samples
+	sigemptyset( &action.sa_mask );
+	sigaction( overflow_signal(), &action, nullptr ); // Stays installed so samples pending at stop are ignored
+	bool any( false );
+	for ( size_type e = 0; e < n_events; ++e ) {
+		fds[ e ] = open_counter( specs[ e ] );
+		counts.supported[ e ] = ( fds[ e ] != -1 );
+		if ( counts.supported[ e ] ) any = true;
+	}
+	if ( ! any ) {
+		std::cerr << "Performance counters could not be opened: Check perf_event_paranoid" << std::endl;
+		return false;
+	}
+	for ( size_type e = 0; e < n_events; ++e ) {
+		if ( fds[ e ] != -1 ) {
+			ioctl( fds[ e ], PERF_EVENT_IOC_RESET, 0 );
+			ioctl( fds[ e ], PERF_EVENT_IOC_REFRESH, 1 );
+		}
+	}
+	return true;
+#else
+	std::cerr << "Performance counters are only supported on Linux" << std::endl;
+	return false;
+#endif
+}
+
+// Stop Counting and Return the Counts
+Counts
+stop()
+{
+#ifdef __linux__
+	for ( size_type e = 0; e < n_events; ++e ) {
+		if ( fds[ e ] != -1 ) ioctl( fds[ e ], PERF_EVENT_IOC_DISABLE, 0 );
+	}
+	for ( size_type e = 0; e < n_events; ++e ) {
+		if ( fds[ e ] == -1 ) continue;
+		std::uint64_t values[ 3 ] = { 0u, 0u, 0u }; // Value, time enabled, time running
+		if ( read( fds[ e ], values, sizeof( values ) ) == ssize_t( sizeof( values ) ) ) {
+			counts.total[ e ] = ( ( values[ 2 ] > 0u ) && ( values[ 2 ] < values[ 1 ] ) ? double( values[ 0 ] ) * ( double( values[ 1 ] ) / double( values[ 2 ] ) ) : double( values[ 0 ] ) ); // Scale for multiplexing
+		} else {
+			counts.supported[ e ] = false;
+		}
+		int const fd( fds[ e ] );
+		fds[ e ] = -1;
+		close( fd );
+	}
+#endif
+	return counts;
+}
+
+// Report Counts by Phase
+void
+report( Counts const & c, std::ostream & stream )
+{
+	stream << "\nPerformance counters: Solver thread user mode by phase (sampled attribution)\n";
+	stream << "  " << std::left << std::setw( 12 ) << "phase" << std::right;
+	for ( size_type e = 0; e < n_events; ++e ) stream << std::setw( 16 ) << event_names[ e ];
+	stream << '\n';
+	std::ios_base::fmtflags const flags( stream.flags() );
+	std::streamsize const precision( stream.precision() );
+	stream << std::fixed << std::setprecision( 0 );
+	for ( size_type p = 0; p <= n_phases; ++p ) { // Phases then total
+		stream << "  " << std::left << std::setw( 12 ) << ( p < n_phases ? phase_names[ p ] : "total" ) << std::right;
+		for ( size_type e = 0; e < n_events; ++e ) {
+			if ( c.supported[ e ] ) {
+				stream << std::setw( 16 ) << ( p < n_phases ? c( Phase( p ), Event( e ) ) : c.total[ e ] );
+			} else {
+				stream << std::setw( 16 ) << "n/a";
+			}
+		}
+		stream << '\n';
+	}
+	stream.flags( flags );
+	stream.precision( precision );
+	stream << std::endl;
+}
+
+} // counters
@@ -0,0 +1,139 @@
+#ifndef QSS_Counters_hh_INCLUDED
+#define QSS_Counters_hh_INCLUDED
+
+// QSS Hardware Performance Counters by Solver Phase
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Linux perf_event_open counters of the solver thread in user mode, enabled by --counters in QSS_STATS builds
+// Phase scopes only store the current phase: Reading counters at every scope boundary would cost more than the phases
+// Each counter instead signals the solver thread every period events and the handler credits them to the current phase
+// Totals are read exactly at the end and split across phases in proportion to their samples (statistical attribution)
+// Phases are exclusive: Nested scopes take their events from the enclosing phase
+// Counters the CPU, kernel, or perf_event_paranoid setting don't allow are reported as n/a
+// Phase scopes compile to nothing without QSS_STATS so production event loops are unaffected
+
+// C++ Headers
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+namespace counters {
+
+using size_type = std::size_t;
+
+// Solver Phases
+enum Phase : std::sig_atomic_t {
+ Other, // Event loop control and anything not in another phase
+ Queue, // Event queue top and reschedules
+ Derivative, // Derivative evaluations and requantization in trigger and observer advances
+ Root, // Requantization and zero-crossing end time root solving
+ Output // Requantization and sampled outputs
+};
+size_type const n_phases( 5u );
+
+// Counter Events
+enum Event {
+ Cycles,
+ Instructions,
+ L1D_Misses, // L1 data cache read misses
+ LLC_Misses, // Last level cache misses
+ Branch_Misses,
+ DTLB_Misses, // Data TLB read misses
+ Task_Clock // CPU time (ns): A software counter that works without hardware counter access
+};
+size_type const n_events( 7u );
+
+// Counts by Phase
+struct Counts
+{
+	bool supported[ n_events ] = {}; // Counter opened?
+	double total[ n_events ] = {}; // Exact totals: Scaled for multiplexing
+	std::uint64_t samples[ n_phases ][ n_events ] = {}; // Overflow samples per phase
+
+	// Phase Estimate of an Event
+	double
+	operator ()( Phase const phase, Event const event ) const;
+};
+
+// Current Phase of This Thread
+extern thread_local volatile std::sig_atomic_t phase;
+
+// Phase Name
+char const *
+name( Phase const phase );
+
+// Event Name
+char const *
+name( Event const event );
+
+// Phase Scope: Sets the current phase for its lifetime
+class Scope final
+{
+
+public: // Creation
+
+#ifdef QSS_STATS
+
+	// Constructor
+	explicit
+	Scope( Phase const p ) :
+	 previous_( phase )
+	{
+		phase = p;
+	}
+
+	// Destructor
+	~Scope()
+	{
+		phase = previous_;
+	}
+
+#else
+
+	// Constructor
+	explicit
+	Scope( Phase const )
+	{}
+
+#endif
+
+	// Copy Constructor
+	Scope( Scope const & ) = delete;
+
+public: // Assignment
+
+	// Copy Assignment
+	Scope &
+	operator =( Scope const & ) = delete;
+
+#ifdef QSS_STATS
+
+private: // Data
+
+	std::sig_atomic_t previous_; // Enclosing phase
+
+#endif
+
+};
+
+// Start Counting on This Thread: Returns Whether Any Counter Opened
+bool
+start();
+
+// Stop Counting and Return the Counts
+Counts
+stop();
+
+// Report Counts by Phase
+void
+report( Counts const & counts, std::ostream & stream );
+
+} // counters
+
+#endif
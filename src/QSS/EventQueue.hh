@@ -13,6 +13,11 @@
 // Will need to put mutex locks around modifying operations for concurrent use
 // Should explore concurrent-friendly priority queues once we have large scale cases to test with
 
+// QSS Headers
+#include <QSS/Counters.hh>
+#include <QSS/Memory.hh>
+#include <QSS/Trace.hh>
+
 // C++ Headers
 #include <cassert>
 #include <map>
@@ -60,6 +65,13 @@ public: // Collection Methods
 		return m_.size();
 	}
 
+	// Heap Bytes: Red-black tree nodes hold a color word and 3 links ahead of the value
+	Memory::size_type
+	heap_bytes() const
+	{
+		return m_.size() * Memory::block( sizeof( typename EventMap::value_type ) + ( 4u * sizeof( void * ) ) );
+	}
+
 	// Top Event Variable
 	Variable *
 	top()
@@ -73,6 +85,10 @@ public: // Collection Methods
 	top_time() const
 	{
 		assert ( ! m_.empty() );
+		counters::Scope const counters_scope( counters::Queue );
+#ifdef QSS_TRACE_QUEUE
+		trace::Scope const scope( trace::Phase::Queue_Top );
+#endif
 		return m_.begin()->first;
 	}
 
@@ -111,6 +127,8 @@ public: // Collection Methods
 	Variables
 	simultaneous_variables() const
 	{
+		counters::Scope const counters_scope( counters::Queue );
+		trace::Scope const scope( trace::Phase::Queue_Top );
 		Variables vars;
 		if ( ! m_.empty() ) {
 			const_iterator i( m_.begin() );
@@ -190,6 +208,10 @@ public: // Time Methods
 	 iterator const i
 	)
 	{
+		counters::Scope const counters_scope( counters::Queue );
+#ifdef QSS_TRACE_QUEUE
+		trace::Scope const scope( trace::Phase::Queue_Shift );
+#endif
 		Variable * x( i->second );
 		m_.erase( i );
 		return m_.emplace( t, x ); //Do See if faster to insert with position hint of i
@@ -8,12 +8,17 @@
 
 // QSS Headers
 #include <QSS/FMU.hh>
+#include <QSS/FMU_Pool.hh>
 
 namespace FMU {
 
 // Globals
 fmi2_import_t * fmu( nullptr ); // FMU instance
+std::vector< fmi2_import_t * > fmus; // FMU instances for parallel evaluation: fmus[ 0 ] is fmu
+Pool * pool( nullptr ); // FMU instance worker pool: nullptr unless multiple FMU instances
 std::size_t n_ders( 0 ); // Number of derivatives
 fmi2_real_t * derivatives( nullptr ); // Derivatives
+std::size_t n_event_indicators( 0 ); // Number of event indicators
+fmi2_real_t * event_indicators( nullptr ); // Event indicators
 
 } // FMU
@@ -9,12 +9,16 @@
 // under contract to the National Renewable Energy Laboratory
 // of the U.S. Department of Energy
 
+// QSS Headers
+#include <QSS/Trace.hh>
+
 // FMI Library Headers
 #include <fmilib.h>
 
 // C++ Headers
 #include <cassert>
 #include <cstddef>
+#include <vector>
 
 namespace FMU {
 
@@ -23,16 +27,31 @@ using Value = double;
 
 // Globals
 extern fmi2_import_t * fmu; // FMU instance
+extern std::vector< fmi2_import_t * > fmus; // FMU instances for parallel evaluation: fmus[ 0 ] is fmu
 extern std::size_t n_ders; // Number of derivatives
 extern fmi2_real_t * derivatives; // Derivatives
+extern std::size_t n_event_indicators; // Number of event indicators
+extern fmi2_real_t * event_indicators; // Event indicators
+
+// Multiple FMU Instances?
+inline
+bool
+pooled()
+{
+	return fmus.size() > 1u;
+}
 
-// Set FMU Time
+// Set FMU Time: All Instances
 inline
 void
 set_time( Time const t )
 {
 	assert( fmu != nullptr );
+	trace::Scope const scope( trace::Phase::FMU_Time );
 	fmi2_import_set_time( fmu, t ); //Do Check status returned
+	for ( std::size_t i = 1, n = fmus.size(); i < n; ++i ) {
+		fmi2_import_set_time( fmus[ i ], t );
+	}
 }
 
 // Initialize Derivatives Array Size
@@ -40,11 +59,21 @@ inline
 void
 init_derivatives( std::size_t const n_derivatives )
 {
-	if ( derivatives != nullptr ) delete derivatives;
+	if ( derivatives != nullptr ) delete[] derivatives;
 	n_ders = n_derivatives;
 	derivatives = new fmi2_real_t[ n_ders ]; // Call cleanup() before exit to prevent apparent "leak"
 }
 
+// Initialize Event Indicators Array Size
+inline
+void
+init_event_indicators( std::size_t const n_indicators )
+{
+	if ( event_indicators != nullptr ) delete[] event_indicators;
+	n_event_indicators = n_indicators;
+	event_indicators = new fmi2_real_t[ n_event_indicators ]; // Call cleanup() before exit to prevent apparent "leak"
+}
+
 // Get a Real FMU Variable Value
 inline
 Value
@@ -56,6 +85,17 @@ get_real( fmi2_value_reference_t const ref )
 	return val;
 }
 
+// Get a Real FMU Variable Value from an FMU Instance
+inline
+Value
+get_real( fmi2_import_t * const inst, fmi2_value_reference_t const ref )
+{
+	assert( inst != nullptr );
+	Value val;
+	fmi2_import_get_real( inst, &ref, std::size_t( 1u ), &val ); //Do Check status returned
+	return val;
+}
+
 // Set a Real FMU Variable Value
 inline
 void
@@ -65,12 +105,32 @@ set_real( fmi2_value_reference_t const ref, Value const val )
 	fmi2_import_set_real( fmu, &ref, std::size_t( 1u ), &val ); //Do Check status returned
 }
 
+// Set a Real FMU Variable Value in an FMU Instance
+inline
+void
+set_real( fmi2_import_t * const inst, fmi2_value_reference_t const ref, Value const val )
+{
+	assert( inst != nullptr );
+	fmi2_import_set_real( inst, &ref, std::size_t( 1u ), &val ); //Do Check status returned
+}
+
+// Set Real FMU Variable Values
+inline
+void
+set_reals( fmi2_value_reference_t const * const refs, std::size_t const n, Value const * const vals )
+{
+	assert( fmu != nullptr );
+	trace::Scope const scope( trace::Phase::FMU_Set );
+	fmi2_import_set_real( fmu, refs, n, vals ); //Do Check status returned
+}
+
 // Get All Derivatives Array: FMU Time and Variable Values Must be Set First
 inline
 void
 get_derivatives()
 {
 	assert( derivatives != nullptr );
+	trace::Scope const scope( trace::Phase::FMU_Derivatives );
 	fmi2_import_get_derivatives( fmu, derivatives, n_ders );
 }
 
@@ -83,13 +143,34 @@ get_derivative( std::size_t const der_idx )
 	return derivatives[ der_idx - 1 ];
 }
 
+// Get All Event Indicators Array: FMU Time and Variable Values Must be Set First
+inline
+void
+get_event_indicators()
+{
+	assert( event_indicators != nullptr );
+	trace::Scope const scope( trace::Phase::FMU_Event_Indicators );
+	fmi2_import_get_event_indicators( fmu, event_indicators, n_event_indicators );
+}
+
+// Get an Event Indicator: First call get_event_indicators
+inline
+Value
+get_event_indicator( std::size_t const ei_idx )
+{
+	assert( ei_idx - 1 < n_event_indicators );
+	return event_indicators[ ei_idx - 1 ];
+}
+
 // Cleanup Allocations
 inline
 void
 cleanup()
 {
-	delete derivatives;
+	delete[] derivatives;
 	derivatives = nullptr;
+	delete[] event_indicators;
+	event_indicators = nullptr;
 }
 
 } // FMU
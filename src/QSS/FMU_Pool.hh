@@ -0,0 +1,26 @@
+#ifndef QSS_FMU_Pool_hh_INCLUDED
+#define QSS_FMU_Pool_hh_INCLUDED
+
+// FMU Instance Worker Pool
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// One worker per FMU instance: Task i only touches FMU instance i so tasks run concurrently
+
+// QSS Headers
+#include <QSS/Pool.hh>
+
+namespace FMU {
+
+using Pool = ::Pool;
+
+// Globals
+extern Pool * pool; // FMU instance worker pool: nullptr unless multiple FMU instances
+
+} // FMU
+
+#endif
@@ -0,0 +1,133 @@
+#ifndef QSS_FMU_ZC_Block_hh_INCLUDED
+#define QSS_FMU_ZC_Block_hh_INCLUDED
+
+// FMU Event Indicator Block for Zero-Crossing Variables
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// FMI 2.0 doesn't provide event indicator dependencies so every indicator depends on every QSS state variable
+// The indicator vector is evaluated once per event after all the requantizations at that time and shared by the zero-crossing variables
+// An evaluation is 2 array sets of the states and 2 event indicator gets: Slopes are forward differences over dtND
+
+// QSS Headers
+#include <QSS/FMU.hh>
+#include <QSS/Memory.hh>
+#include <QSS/options.hh>
+#include <QSS/Variable_FMU.hh>
+#include <QSS/Variable_FMU_ZC.hh>
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+// FMU Event Indicator Block for Zero-Crossing Variables
+class FMU_ZC_Block final
+{
+
+public: // Types
+
+	using Time = Variable::Time;
+	using Value = Variable::Value;
+	using Variables_FMU = Variable_FMU::Variables_FMU;
+	using Variables_ZC = std::vector< Variable_FMU_ZC * >;
+	using size_type = std::size_t;
+
+public: // Creation
+
+	// Constructor
+	FMU_ZC_Block(
+	 Variables_FMU const & states, // QSS state variables
+	 Variables_ZC const & zcs // Zero-crossing variables
+	) :
+	 states_( states ),
+	 zcs_( zcs ),
+	 refs_( states.size() ),
+	 vals_( states.size() ),
+	 x_N_( FMU::n_event_indicators )
+	{
+		for ( size_type i = 0, n = states_.size(); i < n; ++i ) refs_[ i ] = states_[ i ]->var.ref;
+	}
+
+public: // Properties
+
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		m.add( Memory::Observers, Memory::heap( states_ ) + Memory::heap( zcs_ ) );
+		m.add( Memory::FMU, Memory::heap( refs_ ) + Memory::heap( vals_ ) + Memory::heap( x_N_ ) );
+	}
+
+public: // Methods
+
+	// Initialize Zero-Crossing Variables at Time t
+	void
+	init( Time const t )
+	{
+		evaluate( t );
+		for ( Variable_FMU_ZC * zc : zcs_ ) zc->init_event();
+	}
+
+	// Advance Zero-Crossing Variables After the Requantizations at Time t: Zero-Crossing Triggers at t are Advanced by the Caller
+	void
+	advance( Time const t )
+	{
+		evaluate( t );
+		for ( Variable_FMU_ZC * zc : zcs_ ) {
+			if ( zc->tE > t ) { // Not a trigger
+				zc->advance_observer();
+#ifdef QSS_STATS
+				++zc->stats.n_observer;
+#endif
+			}
+		}
+	}
+
+	// Advance All Zero-Crossing Variables to Time t After FMU Event Processing
+	void
+	advance_event( Time const t )
+	{
+		evaluate( t );
+		for ( Variable_FMU_ZC * zc : zcs_ ) zc->advance_observer();
+	}
+
+private: // Methods
+
+	// Evaluate the Event Indicators and their Forward-Difference Slopes at Time t: Leaves the FMU at Time t with the States Quantized
+	void
+	evaluate( Time const t )
+	{
+		size_type const n( states_.size() );
+		Time const tN( t + options::dtND ); //API Numeric differentiation (until event indicator derivatives available)
+		FMU::set_time( tN );
+		for ( size_type i = 0; i < n; ++i ) vals_[ i ] = states_[ i ]->qn( tN );
+		FMU::set_reals( refs_.data(), n, vals_.data() );
+		FMU::get_event_indicators();
+		x_N_.assign( FMU::event_indicators, FMU::event_indicators + FMU::n_event_indicators );
+		FMU::set_time( t );
+		for ( size_type i = 0; i < n; ++i ) vals_[ i ] = states_[ i ]->q( t );
+		FMU::set_reals( refs_.data(), n, vals_.data() );
+		FMU::get_event_indicators();
+		for ( Variable_FMU_ZC * zc : zcs_ ) {
+			Value const x_0( FMU::get_event_indicator( zc->idx ) );
+			assert( zc->idx - 1u < x_N_.size() );
+			zc->set_trajectory( t, x_0, ( x_N_[ zc->idx - 1u ] - x_0 ) / options::dtND );
+		}
+	}
+
+private: // Data
+
+	Variables_FMU states_; // QSS state variables the indicators depend on
+	Variables_ZC zcs_; // Zero-crossing variables
+	std::vector< fmi2_value_reference_t > refs_; // State value references
+	std::vector< fmi2_real_t > vals_; // State values
+	std::vector< fmi2_real_t > x_N_; // Event indicators at the numeric differentiation time
+
+};
+
+#endif
@@ -0,0 +1,334 @@
+// FMU Unpack Cache
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/FMU_cache.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+// Platform Headers
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FMU {
+
+namespace { // Internal
+
+// Cache Entry Marker File Name
+char const * const marker_name( ".qss_unpacked" );
+
+// Tables File Name
+char const * const tables_name( ".qss_tables" );
+
+// Tables File Magic Tag
+char const magic[ 4 ] = { 'Q', 'S', 'S', 'T' };
+
+// Tables File Format Version
+std::uint32_t const version( 1u );
+
+// Tables File Header
+struct Header
+{
+	char magic[ 4 ];
+	std::uint32_t version;
+	std::uint64_t n_fmu_vars;
+	std::uint64_t n_reals;
+	std::uint64_t n_outs;
+	std::uint64_t n_ders;
+	std::uint64_t has_deps;
+	std::uint64_t n_deps;
+};
+
+static_assert( sizeof( Header ) == 56u, "Unexpected tables file header size" );
+
+// Key Chunk Size
+std::streamoff const chunk_size( 65536 );
+
+// FNV-1a 64-bit Hash Update
+void
+fnv1a( std::uint64_t & h, char const * const buf, std::size_t const n )
+{
+	for ( std::size_t i = 0; i < n; ++i ) {
+		h ^= static_cast< std::uint64_t >( static_cast< unsigned char >( buf[ i ] ) );
+		h *= 1099511628211ull; // FNV-1a 64-bit prime
+	}
+}
+
+// Report Tables File Error: Returns false
+bool
+tables_error( std::string const & file_name, std::string const & msg )
+{
+	std::cerr << "Warning: FMU tables file " << file_name << ' ' << msg << ": Using the XML" << std::endl;
+	return false;
+}
+
+// Make Directory: Succeeds if Directory Already Exists
+bool
+make_dir( std::string const & path )
+{
+#ifdef _WIN32
+	if ( _mkdir( path.c_str() ) == 0 ) return true;
+#else
+	if ( mkdir( path.c_str(), 0755 ) == 0 ) return true;
+#endif
+	return errno == EEXIST;
+}
+
+// Process ID
+long
+process_id()
+{
+#ifdef _WIN32
+	return static_cast< long >( _getpid() );
+#else
+	return static_cast< long >( getpid() );
+#endif
+}
+
+} // Internal
+
+std::uint64_t const Tables::none( std::numeric_limits< std::uint64_t >::max() ); // No index
+
+// Tables View of Built Tables
+Tables_View
+view_of( Tables const & tables )
+{
+	Tables_View view;
+	view.n_fmu_vars = tables.n_fmu_vars;
+	view.n_reals = tables.reals.size();
+	view.n_outs = tables.outs.size();
+	view.n_ders = tables.ders.size();
+	view.has_deps = tables.has_deps;
+	view.n_deps = tables.deps.size();
+	view.reals = tables.reals.data();
+	view.outs = tables.outs.data();
+	view.ders = tables.ders.data();
+	view.states = tables.states.data();
+	view.dep_start = tables.dep_start.data();
+	view.deps = tables.deps.data();
+	view.dep_kinds = tables.dep_kinds.data();
+	return view;
+}
+
+// Tables File Path of a Cache Entry
+std::string
+tables_path( std::string const & entry_path )
+{
+	return entry_path + '/' + tables_name;
+}
+
+// Write a Tables File: Returns Whether Successful: Written to a Temporary File and Renamed into Place
+bool
+write_tables( std::string const & file_name, Tables const & tables )
+{
+	std::uint64_t const n_ders( tables.ders.size() );
+	if ( ( tables.states.size() != n_ders ) || ( tables.has_deps && ( tables.dep_start.size() != n_ders + 1u ) ) || ( tables.dep_kinds.size() != tables.deps.size() ) ) return false;
+	std::string const temp_name( file_name + ".tmp" + std::to_string( process_id() ) );
+	{
+		std::ofstream out( temp_name, std::ios_base::binary | std::ios_base::out | std::ios_base::trunc );
+		if ( ! out ) return false;
+		Header header;
+		std::memcpy( header.magic, magic, sizeof( magic ) );
+		header.version = version;
+		header.n_fmu_vars = tables.n_fmu_vars;
+		header.n_reals = tables.reals.size();
+		header.n_outs = tables.outs.size();
+		header.n_ders = n_ders;
+		header.has_deps = tables.has_deps ? 1u : 0u;
+		header.n_deps = tables.deps.size();
+		auto put = [&out]( std::vector< std::uint64_t > const & v ){ out.write( reinterpret_cast< char const * >( v.data() ), std::streamsize( v.size() * sizeof( std::uint64_t ) ) ); };
+		out.write( reinterpret_cast< char const * >( &header ), sizeof( Header ) );
+		put( tables.reals );
+		put( tables.outs );
+		put( tables.ders );
+		put( tables.states );
+		put( tables.dep_start );
+		put( tables.deps );
+		out.write( tables.dep_kinds.data(), std::streamsize( tables.dep_kinds.size() ) );
+		if ( ! out ) {
+			out.close();
+			std::remove( temp_name.c_str() );
+			return false;
+		}
+	}
+	if ( std::rename( temp_name.c_str(), file_name.c_str() ) != 0 ) {
+		std::remove( temp_name.c_str() );
+		return false;
+	}
+	return true;
+}
+
+// Destructor
+Mapped_Tables::
+~Mapped_Tables()
+{
+#ifndef _WIN32
+	if ( map_ != nullptr ) ::munmap( map_, size_ );
+#endif
+}
+
+// Open and Validate: Returns Whether Successful
+bool
+Mapped_Tables::
+open( std::string const & file_name, Tables_View & view )
+{
+	{ // Quietly absent: Entries are committed before their tables are written
+		std::ifstream probe( file_name );
+		if ( ! probe ) return false;
+	}
+#ifndef _WIN32
+	int const fd( ::open( file_name.c_str(), O_RDONLY ) );
+	if ( fd < 0 ) return tables_error( file_name, "could not be opened" );
+	struct stat st;
+	if ( ( ::fstat( fd, &st ) != 0 ) || ( st.st_size < off_t( sizeof( Header ) ) ) ) {
+		::close( fd );
+		return tables_error( file_name, "is too short" );
+	}
+	size_ = std::size_t( st.st_size );
+	void * map( ::mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0 ) );
+	::close( fd );
+	if ( map == MAP_FAILED ) return tables_error( file_name, "could not be mapped" );
+	map_ = map;
+	char const * data( static_cast< char const * >( map_ ) );
+#else // Read into an 8-byte aligned buffer
+	std::ifstream stream( file_name, std::ios_base::binary | std::ios_base::in | std::ios_base::ate );
+	if ( ! stream ) return tables_error( file_name, "could not be opened" );
+	size_ = std::size_t( stream.tellg() );
+	if ( size_ < sizeof( Header ) ) return tables_error( file_name, "is too short" );
+	buffer_.resize( ( size_ + 7u ) / 8u );
+	stream.seekg( 0 );
+	if ( ! stream.read( reinterpret_cast< char * >( buffer_.data() ), size_ ) ) return tables_error( file_name, "could not be read" );
+	char const * data( reinterpret_cast< char const * >( buffer_.data() ) );
+#endif
+
+	// Header
+	Header header;
+	std::memcpy( &header, data, sizeof( Header ) );
+	if ( std::memcmp( header.magic, magic, sizeof( magic ) ) != 0 ) return tables_error( file_name, "is not a tables file" );
+	if ( header.version != version ) return tables_error( file_name, "has unsupported version " + std::to_string( header.version ) );
+	std::uint64_t const max_count( size_ / sizeof( std::uint64_t ) ); // Bounds counts so the size check can't overflow
+	if ( ( header.n_reals > max_count ) || ( header.n_outs > max_count ) || ( header.n_ders >= max_count ) || ( header.n_deps > max_count ) || ( header.has_deps > 1u ) ) return tables_error( file_name, "has invalid counts" );
+	std::uint64_t const n_starts( header.has_deps ? header.n_ders + 1u : 0u );
+	if ( size_ != sizeof( Header ) + ( ( header.n_reals + header.n_outs + ( 2u * header.n_ders ) + n_starts + header.n_deps ) * sizeof( std::uint64_t ) ) + header.n_deps ) return tables_error( file_name, "size doesn't match its header" );
+
+	// Arrays
+	view.n_fmu_vars = header.n_fmu_vars;
+	view.n_reals = header.n_reals;
+	view.n_outs = header.n_outs;
+	view.n_ders = header.n_ders;
+	view.has_deps = header.has_deps != 0u;
+	view.n_deps = header.n_deps;
+	std::uint64_t const * a( reinterpret_cast< std::uint64_t const * >( data + sizeof( Header ) ) );
+	view.reals = a;
+	view.outs = a += header.n_reals;
+	view.ders = a += header.n_outs;
+	view.states = a += header.n_ders;
+	view.dep_start = a += header.n_ders;
+	view.deps = a += n_starts;
+	view.dep_kinds = reinterpret_cast< char const * >( a + header.n_deps );
+
+	// Contents
+	for ( std::uint64_t i = 0; i < view.n_reals; ++i ) {
+		if ( view.reals[ i ] >= view.n_fmu_vars ) return tables_error( file_name, "has an invalid variable index" );
+	}
+	for ( std::uint64_t i = 0; i < view.n_outs; ++i ) {
+		if ( view.outs[ i ] >= view.n_fmu_vars ) return tables_error( file_name, "has an invalid variable index" );
+	}
+	if ( view.has_deps ) {
+		if ( ( view.dep_start[ 0 ] != 0u ) || ( view.dep_start[ view.n_ders ] != view.n_deps ) ) return tables_error( file_name, "has invalid dependency offsets" );
+		for ( std::uint64_t i = 0; i < view.n_ders; ++i ) {
+			if ( view.dep_start[ i ] > view.dep_start[ i + 1u ] ) return tables_error( file_name, "has invalid dependency offsets" );
+		}
+	} else if ( view.n_deps != 0u ) {
+		return tables_error( file_name, "has invalid counts" );
+	}
+	return true;
+}
+
+// Cache Key of an FMU File as Hex String: Empty if File Can't be Read
+std::string
+cache_key( std::string const & path )
+{
+	struct stat st;
+	if ( ::stat( path.c_str(), &st ) != 0 ) return std::string();
+	std::ifstream in( path, std::ios_base::binary );
+	if ( ! in ) return std::string();
+	std::uint64_t h( 14695981039346656037ull ); // FNV-1a 64-bit offset basis
+	std::uint64_t const stamp[ 2 ] = { std::uint64_t( st.st_size ), std::uint64_t( st.st_mtime ) };
+	fnv1a( h, reinterpret_cast< char const * >( stamp ), sizeof( stamp ) );
+	std::streamoff const size( st.st_size );
+	char buf[ chunk_size ];
+	if ( in.read( buf, std::min( size, chunk_size ) ) ) fnv1a( h, buf, std::size_t( in.gcount() ) ); // Head: Local header of the first member
+	if ( size > chunk_size ) { // Tail: Zip central directory
+		std::streamoff const tail( std::min( size - chunk_size, chunk_size ) );
+		in.seekg( size - tail );
+		if ( in.read( buf, tail ) ) fnv1a( h, buf, std::size_t( in.gcount() ) );
+	}
+	if ( ! in ) return std::string();
+	std::ostringstream hex;
+	hex << std::hex << std::setw( 16 ) << std::setfill( '0' ) << h;
+	return hex.str();
+}
+
+// Cache Entry Path for an FMU: Empty if FMU Can't be Read
+std::string
+cache_path( std::string const & cache_dir, std::string const & fmu_path )
+{
+	std::string const key( cache_key( fmu_path ) );
+	if ( key.empty() ) return std::string();
+	make_dir( cache_dir );
+	return cache_dir + '/' + key;
+}
+
+// Cache Entry is Complete?
+bool
+cache_valid( std::string const & entry_path )
+{
+	std::ifstream marker( entry_path + '/' + marker_name );
+	return marker.good();
+}
+
+// Staging Path for Unpacking a Cache Entry: Created and Unique to this Process
+std::string
+cache_staging_path( std::string const & entry_path )
+{
+	std::string const staging_path( entry_path + ".tmp" + std::to_string( process_id() ) );
+	make_dir( staging_path );
+	return staging_path;
+}
+
+// Commit a Staged Unpack to its Cache Entry: Returns Whether the Staging Directory Was Moved into Place
+bool
+cache_commit( std::string const & staging_path, std::string const & entry_path )
+{
+	{ // Mark staged unpack complete before it becomes visible
+		std::ofstream marker( staging_path + '/' + marker_name );
+		if ( ! marker ) return false;
+		marker << "FMI 2.0\n";
+	}
+	return std::rename( staging_path.c_str(), entry_path.c_str() ) == 0; // Fails if a concurrent run committed first
+}
+
+} // FMU
@@ -0,0 +1,133 @@
+#ifndef QSS_FMU_cache_hh_INCLUDED
+#define QSS_FMU_cache_hh_INCLUDED
+
+// FMU Unpack Cache
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Unpacked FMUs are kept in a cache directory under a subdirectory named by an FMU key
+// The key hashes the FMU size and modification time and its first and last 64 KiB chunks
+//  The last chunk holds the zip central directory with the CRC-32 and size of every member so content changes change the key
+// Runs of an FMU already in the cache skip the unzip step and load the binaries from the cache
+// A marker file written after a complete unpack identifies valid cache entries
+// The variable, derivative, and dependency tables derived from the XML are saved in the entry on first use
+//  Later runs map that file and build the QSS variables and observer graph from it instead of from the XML model structure
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace FMU {
+
+// FMU Model Structure Tables: Derived from the XML
+// Variable indexes are 0-based FMU variable list positions unless noted
+struct Tables
+{
+	static std::uint64_t const none; // No index
+
+	std::uint64_t n_fmu_vars{ 0u }; // FMU variables
+	std::vector< std::uint64_t > reals; // Continuous real variables
+	std::vector< std::uint64_t > outs; // Real output variables
+	std::vector< std::uint64_t > ders; // Derivative variables by derivative list position: none => Non-real derivative
+	std::vector< std::uint64_t > states; // State variables by derivative list position: >= n_fmu_vars => No continuous real state
+	bool has_deps{ false }; // Dependency info present?
+	std::vector< std::uint64_t > dep_start; // Dependency offsets by derivative list position: n_ders + 1 entries when present
+	std::vector< std::uint64_t > deps; // Dependency variables: 1-based FMU variable indexes with 0 => Depends on all
+	std::vector< char > dep_kinds; // Dependency factor kinds
+};
+
+// FMU Model Structure Tables View: Arrays of Built Tables or a Mapped Tables File
+struct Tables_View
+{
+	std::uint64_t n_fmu_vars{ 0u };
+	std::uint64_t n_reals{ 0u };
+	std::uint64_t n_outs{ 0u };
+	std::uint64_t n_ders{ 0u };
+	bool has_deps{ false };
+	std::uint64_t n_deps{ 0u };
+	std::uint64_t const * reals{ nullptr };
+	std::uint64_t const * outs{ nullptr };
+	std::uint64_t const * ders{ nullptr };
+	std::uint64_t const * states{ nullptr };
+	std::uint64_t const * dep_start{ nullptr };
+	std::uint64_t const * deps{ nullptr };
+	char const * dep_kinds{ nullptr };
+};
+
+// Tables View of Built Tables
+Tables_View
+view_of( Tables const & tables );
+
+// Tables File Path of a Cache Entry
+std::string
+tables_path( std::string const & entry_path );
+
+// Write a Tables File: Returns Whether Successful: Written to a Temporary File and Renamed into Place
+bool
+write_tables( std::string const & file_name, Tables const & tables );
+
+// Memory-Mapped Tables File
+class Mapped_Tables
+{
+
+public: // Creation
+
+	// Default Constructor
+	Mapped_Tables()
+	{}
+
+	// Copy Constructor
+	Mapped_Tables( Mapped_Tables const & ) = delete;
+
+	// Destructor
+	~Mapped_Tables();
+
+public: // Assignment
+
+	// Copy Assignment
+	Mapped_Tables &
+	operator =( Mapped_Tables const & ) = delete;
+
+public: // Methods
+
+	// Open and Validate: Returns Whether Successful
+	bool
+	open( std::string const & file_name, Tables_View & view );
+
+private: // Data
+
+	std::size_t size_{ 0u }; // File size
+	void * map_{ nullptr }; // Mapped file
+	std::vector< std::uint64_t > buffer_; // File contents where mapping is unavailable
+
+};
+
+// Cache Key of an FMU File as Hex String: Empty if File Can't be Read
+std::string
+cache_key( std::string const & path );
+
+// Cache Entry Path for an FMU: Empty if FMU Can't be Read
+std::string
+cache_path( std::string const & cache_dir, std::string const & fmu_path );
+
+// Cache Entry is Complete?
+bool
+cache_valid( std::string const & entry_path );
+
+// Staging Path for Unpacking a Cache Entry: Created and Unique to this Process
+std::string
+cache_staging_path( std::string const & entry_path );
+
+// Commit a Staged Unpack to its Cache Entry: Returns Whether the Staging Directory Was Moved into Place
+bool
+cache_commit( std::string const & staging_path, std::string const & entry_path );
+
+} // FMU
+
+#endif
@@ -8,24 +8,42 @@
 
 // QSS Headers
 #include <QSS/FMU_simulate.hh>
+#include <QSS/Counters.hh>
 #include <QSS/FMU.hh>
+#include <QSS/FMU_cache.hh>
+#include <QSS/FMU_Pool.hh>
 #include <QSS/FMU_Variable.hh>
+#include <QSS/FMU_ZC_Block.hh>
 #include <QSS/globals.hh>
 #include <QSS/math.hh>
+#include <QSS/Memory.hh>
 #include <QSS/options.hh>
+#include <QSS/Output.hh>
+#include <QSS/Output_Binary.hh>
+#include <QSS/Output_Filter.hh>
+#include <QSS/Output_Mapped.hh>
+#include <QSS/Output_Queue.hh>
+#include <QSS/Output_Sampler.hh>
+#include <QSS/Output_Segments.hh>
+#include <QSS/Output_Stream.hh>
+#include <QSS/Stats.hh>
+#include <QSS/Trace.hh>
 #include <QSS/Variable_FMU_QSS1.hh>
 #include <QSS/Variable_FMU_QSS2.hh>
+#include <QSS/Variable_FMU_ZC.hh>
 
 // C++ Headers
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstdlib>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <stdexcept>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 // FMI Library Headers
@@ -37,28 +55,129 @@ namespace FMU {
 void
 do_event_iteration( fmi2_import_t * fmu, fmi2_event_info_t * eventInfo );
 
+void
+dump_variable( fmi2_import_variable_t * var, std::size_t const idx, fmi2_value_reference_t const ref );
+
+void
+dump_derivative( fmi2_import_variable_t * der, fmi2_value_reference_t const ref );
+
+void
+dump_dependency( std::size_t const dep_idx, fmi2_dependency_factor_kind_enu_t const kind );
+
+std::string
+causality_name( fmi2_causality_enu_t const causality );
+
+Tables
+tables_of_xml( fmi2_import_t * fmu, fmi2_import_variable_list_t * var_list, fmi2_import_variable_list_t * der_list );
+
+namespace { // Internal
+
+// FMU Instance Ownership
+struct Instance
+{
+	// Constructor
+	explicit
+	Instance( fmi2_import_t * fmu ) :
+	 fmu( fmu )
+	{}
+
+	fmi2_import_t * fmu; // FMU
+	bool dll{ false }; // DLL loaded?
+	bool instantiated{ false }; // Instantiated?
+};
+
+// Simulation Resources: Released on Return or Exception
+struct Resources final
+{
+	// Default Constructor
+	Resources() = default;
+
+	// Copy Constructor
+	Resources( Resources const & ) = delete;
+
+	// Copy Assignment
+	Resources &
+	operator =( Resources const & ) = delete;
+
+	// Destructor
+	~Resources()
+	{
+		// QSS cleanup
+		for ( auto & var : vars ) delete var;
+		for ( auto & zc : zcs ) delete zc;
+		FMU::cleanup();
+
+		// FMI Library cleanup
+		delete FMU::pool;
+		FMU::pool = nullptr;
+		for ( auto i = instances.rbegin(), e = instances.rend(); i != e; ++i ) { // Additional instances first
+			if ( i->instantiated ) {
+				fmi2_import_terminate( i->fmu );
+				fmi2_import_free_instance( i->fmu );
+			}
+			if ( i->dll ) fmi2_import_destroy_dllfmu( i->fmu );
+			fmi2_import_free( i->fmu );
+		}
+		FMU::fmu = nullptr;
+		FMU::fmus.clear();
+		std::free( states );
+		std::free( states_der );
+		std::free( var_list );
+		std::free( der_list );
+		if ( ! staging.empty() ) fmi_import_rmdir( &callbacks, staging.c_str() ); // Uncommitted cache unpack
+		if ( context != nullptr ) fmi_import_free_context( context );
+	}
+
+	jm_callbacks callbacks; // FMI Library callbacks: Referenced by the context
+	fmi_import_context_t * context{ nullptr }; // FMI Library context
+	std::vector< Instance > instances; // FMU instances: Main instance first
+	fmi2_real_t * states{ nullptr }; // Continuous states
+	fmi2_real_t * states_der{ nullptr }; // Continuous state derivatives
+	fmi2_import_variable_list_t * var_list{ nullptr }; // FMU variables
+	fmi2_import_variable_list_t * der_list{ nullptr }; // FMU derivatives
+	std::string staging; // Cache staging directory to remove
+	Variable_FMU::Variables_FMU vars; // QSS variables
+	std::vector< Variable_FMU_ZC * > zcs; // Zero-crossing variables
+};
+
+} // Internal
+
 // Simulate an FMU Model
 void
-simulate()
+simulate( Output_Sink * sink )
 {
 	// Types
 	using size_type = std::size_t;
 	using Time = Variable::Time;
 	using Value = Variable::Value;
-	using FMU_Vars = std::unordered_map< fmi2_import_real_variable_t *, FMU_Variable >; // Map from FMU variables to FMU_Variable objects
-	using FMU_Idxs = std::unordered_map< size_type, Variable_FMU * >; // Map from FMU variable indexes to QSS Variables
-	using QSS_Vars = std::unordered_map< Variable *, size_type >; // Map from QSS variables to their indexes
+	using FMU_Vars = std::vector< FMU_Variable >; // FMU_Variable objects
 
 	// I/o setup
 	std::cout << std::setprecision( 16 );
 	std::cerr << std::setprecision( 16 );
-	std::vector< std::ofstream > x_streams; // Continuous output streams
-	std::vector< std::ofstream > q_streams; // Quantized output streams
-	std::vector< std::ofstream > f_streams; // FMU output streams
+	std::unique_ptr< Output_Sink > file_sink; // Binary or memory-mapped output file
+	if ( sink == nullptr ) {
+		if ( options::output::b ) {
+			file_sink.reset( new Output_Binary_Writer( output_binary_name( options::model ), 256u, options::output::z ) );
+		} else if ( options::output::m ) {
+			file_sink.reset( new Output_Mapped_Writer( output_mapped_name( options::model ) ) );
+		}
+		sink = file_sink.get(); // nullptr => Text files
+	}
+	std::unique_ptr< Output_Stream_Writer > stream( options::stream.empty() ? nullptr : new Output_Stream_Writer( options::stream ) ); // Live output stream
+	Output x_out( 'x', sink, stream.get() ); // Continuous outputs
+	Output q_out( 'q', sink, stream.get() ); // Quantized outputs
+	Output f_out( 'f', sink, stream.get() ); // FMU outputs
+	std::unique_ptr< Output_Segments_Writer > segments( options::output::p ? new Output_Segments_Writer( output_segments_name( options::model ) ) : nullptr ); // Trajectory segments file
 
 	// Controls
 	int const QSS_order_max( options::qss_order ); // Highest QSS order in use or 3 to handle all supported orders
 
+	// Startup timing
+	using Clock = std::chrono::steady_clock;
+	auto seconds = []( Clock::time_point const b, Clock::time_point const e ) -> double { return std::chrono::duration< double >( e - b ).count(); };
+	Clock::time_point const time_beg( Clock::now() );
+
 	// FMI Library setup /////
 
 #ifdef _WIN32
@@ -68,7 +187,19 @@ simulate()
 	char const * tmpPath( "/tmp" );
 #endif
 
-	jm_callbacks callbacks;
+	std::string unpackPath( tmpPath ); // Directory the FMU is unpacked into
+	bool const cached( ! options::cache.empty() );
+	bool cache_hit( false );
+	if ( cached ) { // Use content-hashed cache entry
+		unpackPath = FMU::cache_path( options::cache, options::model );
+		if ( unpackPath.empty() ) {
+			throw std::runtime_error( "FMU file could not be read: " + options::model );
+		}
+		cache_hit = FMU::cache_valid( unpackPath );
+	}
+
+	Resources res; // Released on return or exception
+	jm_callbacks & callbacks( res.callbacks );
 	callbacks.malloc = std::malloc;
 	callbacks.calloc = std::calloc;
 	callbacks.realloc = std::realloc;
@@ -77,22 +208,38 @@ simulate()
 	callbacks.log_level = jm_log_level_warning;
 	callbacks.context = 0;
 
-	fmi_import_context_t * const context( fmi_import_allocate_context( &callbacks ) );
-	fmi_version_enu_t const fmi_version( fmi_import_get_fmi_version( context, options::model.c_str(), tmpPath ) );
-	if ( fmi_version != fmi_version_2_0_enu ) {
-		std::cerr << "Error: Only FMI version 2.0 is supported" << std::endl;
-		std::exit( EXIT_FAILURE );
+	fmi_import_context_t * const context( res.context = fmi_import_allocate_context( &callbacks ) );
+	if ( cache_hit ) { // Only complete FMI 2.0 unpacks are committed to the cache
+		std::cout << "FMU unpack cached in " << unpackPath << std::endl;
+	} else {
+		std::string const unzipPath( cached ? FMU::cache_staging_path( unpackPath ) : unpackPath );
+		if ( cached ) res.staging = unzipPath;
+		fmi_version_enu_t const fmi_version( fmi_import_get_fmi_version( context, options::model.c_str(), unzipPath.c_str() ) );
+		if ( fmi_version != fmi_version_2_0_enu ) {
+			throw std::runtime_error( "Only FMI version 2.0 is supported" );
+		}
+		if ( cached ) {
+			if ( FMU::cache_commit( unzipPath, unpackPath ) ) {
+				res.staging.clear();
+			} else { // Another run committed this entry first
+				if ( ! FMU::cache_valid( unpackPath ) ) { // Use the staged unpack: Removed after the run
+					std::cerr << "Warning: FMU unpack could not be added to the cache" << std::endl;
+					unpackPath = unzipPath;
+				}
+			}
+		}
 	}
 	fmi2_xml_callbacks_t * xml_callbacks( nullptr );
-	fmi2_import_t * const fmu( fmi2_import_parse_xml( context, tmpPath, xml_callbacks ) );
+	fmi2_import_t * const fmu( fmi2_import_parse_xml( context, unpackPath.c_str(), xml_callbacks ) );
 	if ( !fmu ) {
-		std::cerr << "Error: FMU XML parsing error" << std::endl;
-		std::exit( EXIT_FAILURE );
+		throw std::runtime_error( "FMU XML parsing error" );
 	}
+	res.instances.emplace_back( fmu );
 	FMU::fmu = fmu;
+	FMU::fmus.assign( 1u, fmu );
+	Clock::time_point const time_fmu_parse( Clock::now() );
 	if ( fmi2_import_get_fmu_kind( fmu ) == fmi2_fmu_kind_cs ) {
-		std::cerr << "Error: Only FMU ME is supported: Supplied FMU is CS" << std::endl;
-		std::exit( EXIT_FAILURE );
+		throw std::runtime_error( "Only FMU ME is supported: Supplied FMU is CS" );
 	}
 
 	fmi2_callback_functions_t callBackFunctions;
@@ -102,27 +249,32 @@ simulate()
 	callBackFunctions.componentEnvironment = fmu;
 
 	if ( fmi2_import_create_dllfmu( fmu, fmi2_fmu_kind_me, &callBackFunctions ) == jm_status_error ) {
-		std::cerr << "Error: Could not create the FMU library loading mechanism" << std::endl;
-		std::exit( EXIT_FAILURE );
+		throw std::runtime_error( "Could not create the FMU library loading mechanism" );
 	}
+	res.instances.back().dll = true;
 
 	size_type const n_states( fmi2_import_get_number_of_continuous_states( fmu ) );
 	std::cout << n_states << " continuous variables" << std::endl;
 	size_type const n_event_indicators( fmi2_import_get_number_of_event_indicators( fmu ) );
 	std::cout << n_event_indicators << " event indicators" << std::endl;
 
-	fmi2_real_t * const states( (fmi2_real_t*)std::calloc( n_states, sizeof( double ) ) );
-	fmi2_real_t * const states_der( (fmi2_real_t*)std::calloc( n_states, sizeof( double ) ) );
-	fmi2_real_t * const event_indicators( (fmi2_real_t*)std::calloc( n_event_indicators, sizeof( double ) ) );
-	fmi2_real_t * const event_indicators_prev( (fmi2_real_t*)std::calloc( n_event_indicators, sizeof( double ) ) );
+	fmi2_real_t * const states( res.states = (fmi2_real_t*)std::calloc( n_states, sizeof( double ) ) );
+	res.states_der = (fmi2_real_t*)std::calloc( n_states, sizeof( double ) );
+	FMU::init_event_indicators( n_event_indicators );
 
 	if ( fmi2_import_instantiate( fmu, "FMU ME model instance", fmi2_model_exchange, 0, 0 ) == jm_status_error ) {
-		std::cerr << "Error: fmi2_import_instantiate failed" << std::endl;
-		std::exit( EXIT_FAILURE );
+		throw std::runtime_error( "fmi2_import_instantiate failed" );
 	}
+	res.instances.back().instantiated = true;
 
 	fmi2_import_set_debug_logging( fmu, fmi2_false, 0, 0 );
 
+	// Completed integrator step calls: Skip if FMU says they aren't needed
+	bool const cis_needed( fmi2_import_get_capability( fmu, fmi2_me_completedIntegratorStepNotNeeded ) == 0u );
+	if ( ! cis_needed ) std::cout << "FMU completed integrator step calls not needed" << std::endl;
+	size_type n_cis_events( 0 ); // Events since last completed integrator step call
+	size_type n_cis_event_updates( 0 ); // Completed integrator step calls requesting event mode
+
 	// Don't see an FMIL call to see if DefaultExperiment is present
 	//  The defaults for these 3 values are: 0, 1.0, and 0.0001
 	//  Should provide the user a way to override them along with other controls
@@ -159,143 +311,108 @@ simulate()
 	do_event_iteration( fmu, &eventInfo );
 	fmi2_import_enter_continuous_time_mode( fmu );
 	fmi2_import_get_continuous_states( fmu, states, n_states ); // Should get initial values
-	fmi2_import_get_event_indicators( fmu, event_indicators, n_event_indicators );
+
+	// Additional FMU instances for parallel evaluation of QSS variable partitions
+	if ( options::fmus > 1 ) {
+		if ( fmi2_import_get_capability( fmu, fmi2_me_canBeInstantiatedOnlyOncePerProcess ) != 0u ) {
+			throw std::runtime_error( "FMU can only be instantiated once per process: Multiple FMU instances not supported" );
+		}
+		for ( int k = 1; k < options::fmus; ++k ) {
+			fmi2_import_t * const fmu_k( fmi2_import_parse_xml( context, unpackPath.c_str(), xml_callbacks ) );
+			if ( !fmu_k ) {
+				throw std::runtime_error( "FMU XML parsing error" );
+			}
+			res.instances.emplace_back( fmu_k );
+			fmi2_callback_functions_t callBackFunctions_k( callBackFunctions );
+			callBackFunctions_k.componentEnvironment = fmu_k;
+			if ( fmi2_import_create_dllfmu( fmu_k, fmi2_fmu_kind_me, &callBackFunctions_k ) == jm_status_error ) {
+				throw std::runtime_error( "Could not create the FMU library loading mechanism" );
+			}
+			res.instances.back().dll = true;
+			if ( fmi2_import_instantiate( fmu_k, ( "FMU ME model instance " + std::to_string( k ) ).c_str(), fmi2_model_exchange, 0, 0 ) == jm_status_error ) {
+				throw std::runtime_error( "fmi2_import_instantiate failed" );
+			}
+			res.instances.back().instantiated = true;
+			fmi2_import_set_debug_logging( fmu_k, fmi2_false, 0, 0 );
+			fmi2_import_setup_experiment( fmu_k, toleranceControlled, relativeTolerance, tstart, stopTimeDefined, tstop );
+			fmi2_import_enter_initialization_mode( fmu_k );
+			fmi2_import_exit_initialization_mode( fmu_k );
+			fmi2_event_info_t eventInfo_k( eventInfo );
+			do_event_iteration( fmu_k, &eventInfo_k );
+			fmi2_import_enter_continuous_time_mode( fmu_k );
+			FMU::fmus.push_back( fmu_k );
+		}
+		std::cout << "\n" << FMU::fmus.size() << " FMU instances for parallel evaluation" << std::endl;
+	}
+	if ( options::threads > 1 ) std::cout << "\nNote: --threads applies to example models: Use --fmus for parallel FMU evaluation" << std::endl;
 
 	// FMU Query: Model
 	std::cout << "\nModel name: " << fmi2_import_get_model_name( fmu ) << std::endl;
 	std::cout << "Model identifier: " << fmi2_import_get_model_identifier_ME( fmu ) << std::endl;
+	Clock::time_point const time_fmu_init( Clock::now() );
 
-	// Process FMU variables
-	FMU_Vars fmu_vars;
-	FMU_Vars fmu_outs;
-	fmi2_import_variable_list_t * var_list( fmi2_import_get_variable_list( fmu, 0 ) ); // sort order = 0 for original order
+	// FMU model structure tables: Mapped from the cache entry or built from the XML
+	fmi2_import_variable_list_t * var_list( res.var_list = fmi2_import_get_variable_list( fmu, 0 ) ); // sort order = 0 for original order
 	size_type const n_fmu_vars( fmi2_import_get_variable_list_size( var_list ) );
-	std::cout << "\nNum FMU Variables: " << n_fmu_vars << std::endl;
 	fmi2_value_reference_t const * vrs( fmi2_import_get_value_referece_list( var_list ) );
-	for ( size_type i = 0; i < n_fmu_vars; ++i ) {
-		std::cout << "\nVariable  Index: " << i+1 << " Ref: " << vrs[ i ] << std::endl;
-		fmi2_import_variable_t * var( fmi2_import_get_variable( var_list, i ) );
-		std::cout << " Name: " << fmi2_import_get_variable_name( var ) << std::endl;
-		std::cout << " Desc: " << ( fmi2_import_get_variable_description( var ) ? fmi2_import_get_variable_description( var ) : "" ) << std::endl;
-		std::cout << " Ref: " << fmi2_import_get_variable_vr( var ) << std::endl;
-		bool const var_start( fmi2_import_get_variable_has_start( var ) == 1 );
-		std::cout << " Start? " << var_start << std::endl;
-		fmi2_base_type_enu_t var_base_type( fmi2_import_get_variable_base_type( var ) );
-		switch ( var_base_type ) {
-		case fmi2_base_type_real:
-			std::cout << " Type: Real" << std::endl;
-			{
-			fmi2_import_real_variable_t * var_real( fmi2_import_get_variable_as_real( var ) );
-			if ( var_start ) std::cout << " Start: " << fmi2_import_get_real_variable_start( var_real ) << std::endl;
-			if ( fmi2_import_get_variability( var ) == fmi2_variability_enu_continuous ) {
-				fmu_vars[ var_real ] = FMU_Variable( var, var_real, fmi2_import_get_variable_vr( var ), i+1 );
-			}
-			if ( fmi2_import_get_causality( var ) == fmi2_causality_enu_output ) {
-				fmu_outs[ var_real ] = FMU_Variable( var, var_real, fmi2_import_get_variable_vr( var ), i+1 );
-			}
-			}
-			break;
-		case fmi2_base_type_int:
-			std::cout << " Type: Integer" << std::endl;
-			if ( var_start ) std::cout << " Start: " << fmi2_import_get_integer_variable_start( fmi2_import_get_variable_as_integer( var ) ) << std::endl;
-			break;
-		case fmi2_base_type_bool:
-			std::cout << " Type: Boolean" << std::endl;
-			if ( var_start ) std::cout << " Start: " << fmi2_import_get_boolean_variable_start( fmi2_import_get_variable_as_boolean( var ) ) << std::endl;
-			break;
-		case fmi2_base_type_str:
-			std::cout << " Type: String" << std::endl;
-			if ( var_start ) std::cout << " Start: " << fmi2_import_get_string_variable_start( fmi2_import_get_variable_as_string( var ) ) << std::endl;
-			break;
-		case fmi2_base_type_enum:
-			std::cout << " Type: Enum" << std::endl;
-			if ( var_start ) std::cout << " Start: " << fmi2_import_get_enum_variable_start( fmi2_import_get_variable_as_enum( var ) ) << std::endl;
-			break;
-		default:
-			std::cout << " Type: Unknown" << std::endl;
-			break;
-		}
-		fmi2_variability_enu_t const var_variability( fmi2_import_get_variability( var ) );
-		if ( var_variability == fmi2_variability_enu_constant ) {
-			std::cout << " Variability: Constant" << std::endl;
-		} else if ( var_variability == fmi2_variability_enu_fixed ) {
-			std::cout << " Variability: Fixed" << std::endl;
-		} else if ( var_variability == fmi2_variability_enu_tunable ) {
-			std::cout << " Variability: Tunable" << std::endl;
-		} else if ( var_variability == fmi2_variability_enu_discrete ) {
-			std::cout << " Variability: Discrete" << std::endl;
-		} else if ( var_variability == fmi2_variability_enu_continuous ) {
-			std::cout << " Variability: Continuous" << std::endl;
-		} else if ( var_variability == fmi2_variability_enu_unknown ) {
-			std::cout << " Variability: Unknown" << std::endl;
-		}
-		fmi2_causality_enu_t const var_causality( fmi2_import_get_causality( var ) );
-		if ( var_causality == fmi2_causality_enu_parameter ) {
-			std::cout << " Causality: Parameter" << std::endl;
-		} else if ( var_causality == fmi2_causality_enu_calculated_parameter ) {
-			std::cout << " Causality: Calculated Parameter" << std::endl;
-		} else if ( var_causality == fmi2_causality_enu_input ) {
-			std::cout << " Causality: Input" << std::endl;
-		} else if ( var_causality == fmi2_causality_enu_output ) {
-			std::cout << " Causality: Output" << std::endl;
-		} else if ( var_causality == fmi2_causality_enu_local ) {
-			std::cout << " Causality: Local" << std::endl;
-		} else if ( var_causality == fmi2_causality_enu_independent ) {
-			std::cout << " Causality: Independent" << std::endl;
-		} else if ( var_causality == fmi2_causality_enu_unknown ) {
-			std::cout << " Causality: Unknown" << std::endl;
-		}
-		fmi2_initial_enu_t const var_initial( fmi2_import_get_initial( var ) );
-		if ( var_initial == fmi2_initial_enu_exact ) {
-			std::cout << " Initial: Exact" << std::endl;
-		} else if ( var_initial == fmi2_initial_enu_approx ) {
-			std::cout << " Initial: Approx" << std::endl;
-		} else if ( var_initial == fmi2_initial_enu_calculated ) {
-			std::cout << " Initial: Calculated" << std::endl;
-		} else if ( var_initial == fmi2_initial_enu_unknown ) {
-			std::cout << " Initial: Unknown" << std::endl;
+	fmi2_import_variable_list_t * der_list( res.der_list = fmi2_import_get_derivatives_list( fmu ) );
+	size_type const n_ders( fmi2_import_get_variable_list_size( der_list ) );
+	fmi2_value_reference_t const * drs( fmi2_import_get_value_referece_list( der_list ) );
+	Tables tables; // Tables built from the XML
+	Mapped_Tables mapped_tables; // Tables mapped from the cache entry
+	Tables_View view; // Tables in use
+	std::string const tables_file( cached ? tables_path( unpackPath ) : std::string() );
+	if ( cached && mapped_tables.open( tables_file, view ) && ( view.n_fmu_vars == n_fmu_vars ) && ( view.n_ders == n_ders ) ) {
+		std::cout << "FMU tables cached in " << tables_file << std::endl;
+	} else {
+		tables = tables_of_xml( fmu, var_list, der_list );
+		view = view_of( tables );
+		if ( cached && ( ! write_tables( tables_file, tables ) ) ) std::cerr << "Warning: FMU tables could not be added to the cache" << std::endl;
+	}
+
+	// Process FMU variables
+	std::cout << "\nNum FMU Variables: " << n_fmu_vars << std::endl;
+	if ( options::verbose ) {
+		for ( size_type i = 0; i < n_fmu_vars; ++i ) {
+			dump_variable( fmi2_import_get_variable( var_list, i ), i+1, vrs[ i ] );
 		}
 	}
+	FMU_Vars fmu_vars( n_fmu_vars ); // FMU continuous variables indexed by FMU variable index - 1
+	for ( size_type k = 0; k < view.n_reals; ++k ) {
+		size_type const i( view.reals[ k ] );
+		fmi2_import_variable_t * var( fmi2_import_get_variable( var_list, i ) );
+		fmu_vars[ i ] = FMU_Variable( var, fmi2_import_get_variable_as_real( var ), vrs[ i ], i+1 );
+	}
+	FMU_Vars fmu_outs; // FMU output variables
+	fmu_outs.reserve( view.n_outs );
+	for ( size_type k = 0; k < view.n_outs; ++k ) {
+		size_type const i( view.outs[ k ] );
+		fmi2_import_variable_t * var( fmi2_import_get_variable( var_list, i ) );
+		fmu_outs.emplace_back( var, fmi2_import_get_variable_as_real( var ), vrs[ i ], i+1 );
+	}
+	Clock::time_point const time_fmu_vars( Clock::now() );
 
 	// Process FMU derivatives
-	Variable_FMU::Variables_FMU vars; // QSS variables collection
+	Variable_FMU::Variables_FMU & vars( res.vars ); // QSS variables collection
 	Variable_FMU::Variables_FMU outs; // FMU output QSS variables collection
 	vars.reserve( n_states );
-	FMU_Vars fmu_ders; // FMU variable to derivative map
-	FMU_Vars fmu_dvrs; // FMU derivative to variable map
-	FMU_Idxs fmu_idxs;
-	QSS_Vars qss_vars; // Map from QSS variables to their indexes
-	fmi2_import_variable_list_t * der_list( fmi2_import_get_derivatives_list( fmu ) );
-	size_type const n_ders( fmi2_import_get_variable_list_size( der_list ) );
+	Variable_FMU::Variables_FMU fmu_qss( n_fmu_vars + 1u, nullptr ); // QSS variables indexed by FMU variable index
 	std::cout << "\nNum FMU Derivatives: " << n_ders << std::endl;
-	fmi2_value_reference_t const * drs( fmi2_import_get_value_referece_list( der_list ) );
+	Variable_FMU::Variables_FMU der_qss( n_ders, nullptr ); // QSS variables indexed by derivative list position
 	for ( size_type i = 0, ics = 0; i < n_ders; ++i ) {
-		std::cout << "\nDerivative  Ref: " << drs[ i ] << std::endl;
-		fmi2_import_variable_t * der( fmi2_import_get_variable( der_list, i ) );
-		std::cout << " Name: " << fmi2_import_get_variable_name( der ) << std::endl;
-		std::cout << " Desc: " << ( fmi2_import_get_variable_description( der ) ? fmi2_import_get_variable_description( der ) : "" ) << std::endl;
-		std::cout << " Ref: " << fmi2_import_get_variable_vr( der ) << std::endl;
-		fmi2_base_type_enu_t der_base_type( fmi2_import_get_variable_base_type( der ) );
-		bool const der_start( fmi2_import_get_variable_has_start( der ) == 1 );
-		std::cout << " Start? " << der_start << std::endl;
-		switch ( der_base_type ) {
-		case fmi2_base_type_real:
-			{
-			std::cout << " Type: Real" << std::endl;
-			fmi2_import_real_variable_t * der_real( fmi2_import_get_variable_as_real( der ) );
-			if ( der_start ) std::cout << " Start: " << fmi2_import_get_real_variable_start( der_real ) << std::endl;
-			fmi2_import_real_variable_t * var_real( fmi2_import_get_real_variable_derivative_of( der_real ) );
-			if ( var_real != nullptr ) { // Add to Variable to Derivative Map
-				FMU_Variable & fmu_der( fmu_vars[ der_real ] );
-				FMU_Variable & fmu_var( fmu_vars[ var_real ] );
+		if ( options::verbose ) dump_derivative( fmi2_import_get_variable( der_list, i ), drs[ i ] );
+		if ( view.ders[ i ] != Tables::none ) { // Real derivative
+			size_type const der_i( view.ders[ i ] );
+			size_type const var_i( view.states[ i ] );
+			if ( ( der_i < n_fmu_vars ) && ( var_i < n_fmu_vars ) && ( fmu_vars[ der_i ].var != nullptr ) && ( fmu_vars[ var_i ].var != nullptr ) ) {
+				FMU_Variable & fmu_der( fmu_vars[ der_i ] );
+				FMU_Variable & fmu_var( fmu_vars[ var_i ] );
 				Value const states_initial( states[ ics ] ); // Initial value from fmi2_import_get_continuous_states()
 				fmu_der.ics = fmu_var.ics = ++ics;
-				fmu_ders[ var_real ] = fmu_der;
-				fmu_dvrs[ der_real ] = fmu_var;
-				std::cout << " Initial value of " << fmi2_import_get_variable_name( fmu_var.var ) << " = " << states_initial << std::endl;
+				if ( options::verbose ) std::cout << " Initial value of " << fmi2_import_get_variable_name( fmu_var.var ) << " = " << states_initial << '\n';
 				bool const start( fmi2_import_get_variable_has_start( fmu_var.var ) == 1 );
 				if ( start ) {
-					Value const var_initial( fmi2_import_get_real_variable_start( var_real ) );
+					Value const var_initial( fmi2_import_get_real_variable_start( fmu_var.rvr ) );
 					if ( var_initial != states_initial ) {
 						std::cerr << "Warning: Initial value from xml specs: " << var_initial << " is not equal to initial value from fmi2GetContinuousStates(): " << states_initial << std::endl;
 						std::cerr << "         Using initial value from fmi2GetContinuousStates()" << std::endl;
@@ -307,105 +424,106 @@ simulate()
 				} else if ( options::qss == options::QSS::QSS2 ) {
 					qss_var = new Variable_FMU_QSS2( fmi2_import_get_variable_name( fmu_var.var ), options::rTol, options::aTol, states_initial, fmu_var, fmu_der );
 				} else {
-					std::cerr << "Error: Specified QSS method is not yet supported for FMUs" << std::endl;
-					std::exit( EXIT_FAILURE );
+					throw std::runtime_error( "Specified QSS method is not yet supported for FMUs" );
 				}
-				qss_vars[ qss_var ] = ics - 1;
 				vars.push_back( qss_var ); // Add to QSS variables
 				if ( fmi2_import_get_causality( fmu_var.var ) == fmi2_causality_enu_output ) { // Add to FMU QSS variable outputs
 					outs.push_back( qss_var );
-					fmu_outs.erase( fmu_var.rvr ); // Remove it from non-QSS FMU outputs
 				}
-				fmu_idxs[ fmu_var.idx ] = qss_var; // Add to map from FMU variable index to QSS variable
-				std::cout << " FMU idx: " << fmu_var.idx << " maps to QSS var: " << qss_var->name << std::endl;
+				fmu_qss[ fmu_var.idx ] = der_qss[ i ] = qss_var; // Add to FMU variable index and derivative lookups
+				if ( options::verbose ) std::cout << " FMU idx: " << fmu_var.idx << " maps to QSS var: " << qss_var->name << '\n';
 			} else {
-				std::cerr << "Error: Derivative missing associated Variable: " << fmi2_import_get_variable_name( der ) << std::endl;
-				std::exit( EXIT_FAILURE );
-			}
+				throw std::runtime_error( std::string( "Derivative missing associated continuous Variable: " ) + fmi2_import_get_variable_name( fmi2_import_get_variable( der_list, i ) ) );
 			}
-			break;
-		case fmi2_base_type_int:
-			std::cout << " Type: Integer" << std::endl;
-			if ( der_start ) std::cout << " Start: " << fmi2_import_get_integer_variable_start( fmi2_import_get_variable_as_integer( der ) ) << std::endl;
-			break;
-		case fmi2_base_type_bool:
-			std::cout << " Type: Boolean" << std::endl;
-			if ( der_start ) std::cout << " Start: " << fmi2_import_get_boolean_variable_start( fmi2_import_get_variable_as_boolean( der ) ) << std::endl;
-			break;
-		case fmi2_base_type_str:
-			std::cout << " Type: String" << std::endl;
-			if ( der_start ) std::cout << " Start: " << fmi2_import_get_string_variable_start( fmi2_import_get_variable_as_string( der ) ) << std::endl;
-			break;
-		case fmi2_base_type_enum:
-			std::cout << " Type: Enum" << std::endl;
-			if ( der_start ) std::cout << " Start: " << fmi2_import_get_enum_variable_start( fmi2_import_get_variable_as_enum( der ) ) << std::endl;
-			break;
-		default:
-			std::cout << " Type: Unknown" << std::endl;
-			break;
 		}
 	}
 	if ( vars.size() != n_states ) {
 		std::cout << "Warning: Number of QSS variables " << vars.size() << " is not equal to the number of FMU continuous states " << n_states << std::endl;
 	}
+	if ( FMU::pooled() ) { // Partition QSS variables into contiguous blocks: One per FMU instance
+		size_type const n_fmus( FMU::fmus.size() );
+		for ( size_type i = 0, n = vars.size(); i < n; ++i ) {
+			vars[ i ]->fmu = FMU::fmus[ ( i * n_fmus ) / n ];
+		}
+	}
+	fmu_outs.erase( std::remove_if( fmu_outs.begin(), fmu_outs.end(), [&]( FMU_Variable const & var ){ return fmu_qss[ var.idx ] != nullptr; } ), fmu_outs.end() ); // Remove QSS variables from non-QSS FMU outputs
+
+	// Dense variable indexes: Per-variable data is kept in arrays indexed by these instead of pointer-keyed maps
+	for ( size_type i = 0, n = vars.size(); i < n; ++i ) {
+		vars[ i ]->i_var = i;
+	}
+
+	// Output variable selection
+	Output_Filter const filter( output_filter() );
+	Variable_FMU::Variables_FMU out_vars; // QSS variables selected for output
+	for ( auto var : vars ) {
+		if ( filter.selected( var->name, causality_name( fmi2_import_get_causality( var->var.var ) ) ) ) {
+			var->i_out = out_vars.size();
+			out_vars.push_back( var );
+		}
+	}
+	if ( ! filter.all() ) { // FMU outputs are selected by name
+		std::cout << out_vars.size() << " of " << vars.size() << " QSS variables selected for output" << std::endl;
+		outs.erase( std::remove_if( outs.begin(), outs.end(), [&]( Variable_FMU const * var ){ return ! filter.selected( var->name ); } ), outs.end() );
+		fmu_outs.erase( std::remove_if( fmu_outs.begin(), fmu_outs.end(), [&]( FMU_Variable const & var ){ return ! filter.selected( fmi2_import_get_variable_name( var.var ) ); } ), fmu_outs.end() );
+	}
+	x_out.decimate( options::dtOutMin, options::dxOutMin );
+	q_out.decimate( options::dtOutMin, options::dxOutMin );
+	Clock::time_point const time_fmu_ders( Clock::now() );
 
 	// QSS observer setup
-	size_type * startIndex( nullptr );
-	size_type * dependency( nullptr );
-	char * factorKind( nullptr );
-	fmi2_import_get_derivatives_dependencies( fmu, &startIndex, &dependency, &factorKind );
-	if ( startIndex != nullptr ) { // Dependency info present in XML
+	if ( view.has_deps ) { // Dependency info present in XML
 		for ( size_type i = 0; i < n_ders; ++i ) {
-			std::cout << "\nDerivative  Ref: " << drs[ i ] << std::endl;
-			fmi2_import_variable_t * der( fmi2_import_get_variable( der_list, i ) );
-			std::cout << " Name: " << fmi2_import_get_variable_name( der ) << std::endl;
-			fmi2_import_real_variable_t * der_real( fmi2_import_get_variable_as_real( der ) );
-			size_type const idx( fmu_dvrs[ der_real ].idx );
-			std::cout << " Var Index: " << idx << std::endl;
-			Variable_FMU * var( fmu_idxs[ idx ] );
-			std::cout << " QSS Variable: " << var->name << std::endl;
-			for ( size_type j = startIndex[ i ]; j < startIndex[ i + 1 ]; ++j ) {
-				size_type const dep_idx( dependency[ j ] );
-				fmi2_dependency_factor_kind_enu_t const kind( (fmi2_dependency_factor_kind_enu_t)( factorKind[ j ] ) );
-				std::cout << "  Dep Index: " << dep_idx << "  Kind: " << kind << std::endl;
+			Variable_FMU * var( der_qss[ i ] );
+			if ( var == nullptr ) continue; // Non-real derivative
+			if ( options::verbose ) {
+				std::cout << "\nDerivative  Ref: " << drs[ i ] << '\n';
+				std::cout << " Name: " << fmi2_import_get_variable_name( fmi2_import_get_variable( der_list, i ) ) << '\n';
+				std::cout << " Var Index: " << var->var.idx << '\n';
+				std::cout << " QSS Variable: " << var->name << '\n';
+			}
+			for ( size_type j = view.dep_start[ i ]; j < view.dep_start[ i + 1 ]; ++j ) {
+				size_type const dep_idx( view.deps[ j ] );
+				if ( options::verbose ) dump_dependency( dep_idx, (fmi2_dependency_factor_kind_enu_t)( view.dep_kinds[ j ] ) );
 				if ( dep_idx == 0 ) { // No info: Depends on all (don't support depends on all for now)
 					std::cerr << "   Error: No dependency information provided: Depends-on-all not currently supported" << std::endl;
-				} else { // Process based on kind of dependent
-					if ( kind == fmi2_dependency_factor_kind_dependent ) {
-						std::cout << "  Kind: Dependent" << std::endl;
-					} else if ( kind == fmi2_dependency_factor_kind_constant ) {
-						std::cout << "  Kind: Constant" << std::endl;
-					} else if ( kind == fmi2_dependency_factor_kind_fixed ) {
-						std::cout << "  Kind: Fixed" << std::endl;
-					} else if ( kind == fmi2_dependency_factor_kind_tunable ) {
-						std::cout << "  Kind: Tunable" << std::endl;
-					} else if ( kind == fmi2_dependency_factor_kind_discrete ) {
-						std::cout << "  Kind: Discrete" << std::endl;
-					} else if ( kind == fmi2_dependency_factor_kind_num ) {
-						std::cout << "  Kind: Num" << std::endl;
-					}
 				}
-				auto idep( fmu_idxs.find( dep_idx ) ); //Do Add support for input variable dependents
-				if ( idep != fmu_idxs.end() ) {
-					Variable_FMU * dep( idep->second );
-					std::cout << "  QSS var: " << dep->name << " has observer " << var->name << std::endl;
+				Variable_FMU * dep( dep_idx <= n_fmu_vars ? fmu_qss[ dep_idx ] : nullptr ); //Do Add support for input variable dependents
+				if ( dep != nullptr ) {
+					if ( options::verbose ) std::cout << "  QSS var: " << dep->name << " has observer " << var->name << '\n';
 					if ( dep == var ) {
 						var->self_observer = true;
 					} else {
 						dep->add_observer( var );
 						var->add_observee( dep );
 					}
-				} else {
-					//std::cout << "FMU derivative " << fmi2_import_get_variable_name( der ) << " has dependency with index " << dep_idx << " that is not a QSS variable" << std::endl;
 				}
 			}
 		}
 	} else { // Assume no observers in model (this may not be true: FMI spec says no dependencies => dependent on all)
 		std::cout << "No dependency info in FMU XML" << std::endl;
 	}
+	Clock::time_point const time_fmu_deps( Clock::now() );
+	// Zero-crossing variable setup
+	std::vector< Variable_FMU_ZC * > & zcs( res.zcs ); // Event indicator zero-crossing variables
+	zcs.reserve( n_event_indicators );
+	for ( size_type i = 1; i <= n_event_indicators; ++i ) {
+		Variable_FMU_ZC * zc( new Variable_FMU_ZC( "z" + std::to_string( i ), i, options::aTol ) ); // FMI 2.0 event indicators are unnamed
+		zc->i_var = vars.size() + zcs.size(); // Zero-crossing variables follow the QSS variables
+		zcs.push_back( zc );
+	}
+	size_type const n_zcs( zcs.size() );
+	FMU_ZC_Block indicators( vars, zcs ); // FMI 2.0 doesn't provide event indicator dependencies: Indicators depend on all QSS variables
+	if ( FMU::pooled() ) { // Parallel observer advance setup
+		for ( auto var : vars ) {
+			var->group_observers();
+		}
+		FMU::pool = new FMU::Pool( FMU::fmus.size() );
+	}
 
 	// Solver master logic
-	fmi2_import_set_time( fmu, t0 );
+	events.clear(); // Cleared of any earlier run in the process
+	FMU::set_time( t0 );
 	FMU::init_derivatives( n_ders );
 	for ( auto var : vars ) {
 		var->init1_LIQSS();
@@ -417,9 +535,11 @@ simulate()
 		var->init1_fmu();
 	}
 	if ( QSS_order_max >= 2 ) {
-		fmi2_import_set_time( fmu, t = t0 + options::dtND ); //API Numeric differentiation (until higher derivatives available)
-		for ( auto var : vars ) {
-			var->fmu_set_qn( t );
+		FMU::set_time( t = t0 + options::dtND ); //API Numeric differentiation (until higher derivatives available)
+		for ( auto inst : FMU::fmus ) {
+			for ( auto var : vars ) {
+				var->fmu_set_qn( t, inst );
+			}
 		}
 		for ( auto var : vars ) {
 			var->init2_LIQSS();
@@ -432,56 +552,156 @@ simulate()
 				var->init3();
 			}
 		}
-		fmi2_import_set_time( fmu, t = t0 ); // Probably don't need this
+		FMU::set_time( t = t0 ); // Probably don't need this
 	}
 	for ( auto var : vars ) {
 		var->init_event();
 	}
-	size_type const n_vars( vars.size() );
+	if ( n_zcs > 0u ) indicators.init( t0 );
+	Clock::time_point const time_qss_init( Clock::now() );
+	std::cout << "\nStartup timing (s):" << '\n';
+	std::cout << " FMU unpack and XML parse: " << seconds( time_beg, time_fmu_parse ) << '\n';
+	std::cout << " FMU load and initialization: " << seconds( time_fmu_parse, time_fmu_init ) << '\n';
+	std::cout << " FMU variable processing: " << seconds( time_fmu_init, time_fmu_vars ) << '\n';
+	std::cout << " FMU derivative processing: " << seconds( time_fmu_vars, time_fmu_ders ) << '\n';
+	std::cout << " FMU dependency processing: " << seconds( time_fmu_ders, time_fmu_deps ) << '\n';
+	std::cout << " QSS initialization: " << seconds( time_fmu_deps, time_qss_init ) << '\n';
+	std::cout << " Total: " << seconds( time_beg, time_qss_init ) << std::endl;
+	size_type const n_out_vars( out_vars.size() );
 	size_type const n_outs( outs.size() );
 	size_type const n_fmu_outs( fmu_outs.size() );
+	std::unique_ptr< Output_Sampler > sampler( options::output::s && ( options::output::x || options::output::q ) ? new Output_Sampler( out_vars, options::output::x, options::output::q ) : nullptr ); // Sampled QSS outputs
+	auto segment_out = [&]( size_type const i ){ // Put output variable's current trajectory segment
+		Variable const * var( out_vars[ i ] );
+		Variable::Value c[ 4 ];
+		var->x_coefficients( c );
+		segments->put( i, var->tX, var->order(), c );
+	};
+	auto changed = [&]( size_type const i ){ // Output variable's trajectory changed
+		if ( sampler ) sampler->changed( i );
+		if ( segments ) segment_out( i );
+	};
+	auto changed_trigger = [&]( Variable * trigger ){ // Trigger and observer trajectories changed: Unselected and zero-crossing variables are skipped
+		if ( trigger->out() ) changed( trigger->i_out );
+		for ( Variable * observer : trigger->observers() ) {
+			if ( observer->out() ) changed( observer->i_out );
+		}
+	};
 	bool const doSOut( ( options::output::s && ( options::output::x || options::output::q ) ) || ( options::output::f && ( n_outs + n_fmu_outs > 0u ) ) );
 	bool const doROut( options::output::r && ( options::output::x || options::output::q ) );
+	size_type const cis_interval( ( options::cis > 0 ) || doSOut ? options::cis : 1 ); // Events between completed integrator step calls: 0 => Sampled output times only
+	if ( cis_needed && ( options::cis == 0 ) && ( ! doSOut ) ) std::cerr << "Warning: No sampled or FMU outputs for --cis=0: Completed integrator step calls made at every event" << std::endl;
 	size_type n_requant_events( 0 );
+	size_type n_observer_advances( 0 );
+	size_type n_zc_events( 0 );
 	if ( ( options::output::r || options::output::s ) && ( options::output::x || options::output::q ) ) { // t0 QSS outputs
-		for ( auto var : vars ) { // QSS outputs
+		for ( auto var : out_vars ) { // QSS outputs
 			if ( options::output::x ) {
-				x_streams.push_back( std::ofstream( var->name + ".x.out", std::ios_base::binary | std::ios_base::out ) );
-				x_streams.back() << std::setprecision( 16 ) << t << '\t' << var->x( t ) << '\n';
+				x_out.add( var->name );
+				x_out( x_out.size() - 1u, t, var->x( t ) );
 			}
 			if ( options::output::q ) {
-				q_streams.push_back( std::ofstream( var->name + ".q.out", std::ios_base::binary | std::ios_base::out ) );
-				q_streams.back() << std::setprecision( 16 ) << t << '\t' << var->q( t ) << '\n';
+				q_out.add( var->name );
+				q_out( q_out.size() - 1u, t, var->q( t ) );
 			}
 		}
 	}
 	if ( options::output::f && ( n_outs + n_fmu_outs > 0u ) ) { // t0 FMU outputs
 		for ( auto const & var : outs ) { // FMU QSS variable outputs
-			f_streams.push_back( std::ofstream( std::string( fmi2_import_get_variable_name( var->var.var ) ) + ".f.out", std::ios_base::binary | std::ios_base::out ) );
-			f_streams.back() << std::setprecision( 16 ) << t << '\t' << var->x( t ) << '\n';
+			f_out.add( fmi2_import_get_variable_name( var->var.var ) );
+			f_out( f_out.size() - 1u, t, var->x( t ) );
 		}
-		for ( auto const & e : fmu_outs ) { // FMU (non-QSS) variable (non-QSS) outputs
-			FMU_Variable const & var( e.second );
-			f_streams.push_back( std::ofstream( std::string( fmi2_import_get_variable_name( var.var ) ) + ".f.out", std::ios_base::binary | std::ios_base::out ) );
-			f_streams.back() << std::setprecision( 16 ) << t << '\t' << FMU::get_real( var.ref ) << '\n';
+		for ( auto const & var : fmu_outs ) { // FMU (non-QSS) variable (non-QSS) outputs
+			f_out.add( fmi2_import_get_variable_name( var.var ) );
+			f_out( f_out.size() - 1u, t, FMU::get_real( var.ref ) );
 		}
 	}
+	if ( segments ) { // t0 trajectory segments
+		for ( size_type i = 0; i < n_out_vars; ++i ) {
+			segments->add( out_vars[ i ]->name );
+			segment_out( i );
+		}
+	}
+	std::unique_ptr< Output_Queue > queue( options::async != options::Async::None ? new Output_Queue( options::async_buffer, options::async == options::Async::Drop ) : nullptr ); // Asynchronous output
+	if ( queue ) { // Attach after t0 outputs so channels aren't added while the writer thread runs
+		x_out.queue( queue.get() );
+		q_out.queue( queue.get() );
+		f_out.queue( queue.get() );
+	}
+	if ( ! options::trace.empty() ) trace::start( options::trace ); // Solver phase tracing
+#ifdef QSS_STATS
+	bool const counting( options::perf_counters && counters::start() ); // Performance counters by phase
+#endif
+	auto fmu_event = [&]( Time const t ){ // FMU event processing: Event iteration and post-event QSS and zero-crossing variable updates at time t
+		trace::Scope const scope( trace::Phase::FMU_Event );
+		for ( size_type i = 0; i < n_states; ++i ) {
+			states[ i ] = vars[ i ]->x( t );
+		}
+		fmi2_import_set_continuous_states( fmu, states, n_states );
+		fmi2_import_enter_event_mode( fmu );
+		do_event_iteration( fmu, &eventInfo );
+		fmi2_import_enter_continuous_time_mode( fmu );
+		if ( eventInfo.valuesOfContinuousStatesChanged ) { //Do Requantize QSS variables at state value changes
+			std::cerr << "Warning: FMU continuous state changes at events are not yet supported: t = " << t << std::endl;
+		}
+		for ( size_type k = 1; k < FMU::fmus.size(); ++k ) { // Discrete state sync of additional FMU instances
+			fmi2_import_t * const fmu_k( FMU::fmus[ k ] );
+			fmi2_import_set_continuous_states( fmu_k, states, n_states );
+			fmi2_import_enter_event_mode( fmu_k );
+			fmi2_event_info_t eventInfo_k( eventInfo );
+			do_event_iteration( fmu_k, &eventInfo_k );
+			fmi2_import_enter_continuous_time_mode( fmu_k );
+		}
+		for ( auto inst : FMU::fmus ) { // Observer updates for post-event derivatives
+			for ( auto var : vars ) {
+				var->fmu_set_q( t, inst );
+			}
+		}
+		for ( auto var : vars ) {
+			var->advance( t );
+		}
+		if ( QSS_order_max >= 2 ) {
+			Time const tN( t + options::dtND );
+			FMU::set_time( tN ); //API Numeric differentiation
+			for ( auto inst : FMU::fmus ) {
+				for ( auto var : vars ) {
+					var->fmu_set_qn( tN, inst );
+				}
+			}
+			for ( auto var : vars ) {
+				var->advance_2( tN, t );
+			}
+			FMU::set_time( t );
+		}
+		if ( n_zcs > 0u ) indicators.advance_event( t );
+		if ( sampler ) sampler->changed_all(); // All variables advanced
+		if ( segments ) { // Trajectory segments output: All variables advanced
+			for ( size_type i = 0; i < n_out_vars; ++i ) {
+				segment_out( i );
+			}
+		}
+	};
 	while ( t <= tE ) {
 		t = events.top_time();
+		bool sampled( false ); // Sampled output occurred?
 		if ( doSOut ) { // Sampled and/or FMU outputs
 			Time const tStop( std::min( t, tE ) );
 			while ( tOut < tStop ) {
-				if ( options::output::s ) { // QSS variable outputs
-					for ( size_type i = 0; i < n_vars; ++i ) {
-						if ( options::output::x ) x_streams[ i ] << tOut << '\t' << vars[ i ]->x( tOut ) << '\n';
-						if ( options::output::q ) q_streams[ i ] << tOut << '\t' << vars[ i ]->q( tOut ) << '\n';
+				trace::Scope const scope( trace::Phase::Sample );
+				counters::Scope const counters_scope( counters::Output );
+				sampled = true;
+				if ( sampler ) { // QSS variable outputs
+					sampler->sample( tOut );
+					for ( size_type i = 0; i < n_out_vars; ++i ) {
+						if ( options::output::x ) x_out( i, tOut, sampler->x( i ) );
+						if ( options::output::q ) q_out( i, tOut, sampler->q( i ) );
 					}
 				}
 				if ( options::output::f ) {
 					if ( n_outs > 0u ) { // FMU QSS variable outputs
 						for ( size_type i = 0; i < n_outs; ++i ) {
 							Variable * var( outs[ i ] );
-							f_streams[ i ] << tOut << '\t' << var->x( tOut ) << '\n';
+							f_out( i, tOut, var->x( tOut ) );
 						}
 					}
 					if ( n_fmu_outs > 0u ) { // FMU (non-QSS) variable outputs
@@ -491,9 +711,8 @@ simulate()
 						}
 						fmi2_import_set_continuous_states( fmu, states, n_states );
 						size_type i( n_outs );
-						for ( auto const & e : fmu_outs ) {
-							FMU_Variable const & var( e.second );
-							f_streams[ i++ ] << tOut << '\t' << FMU::get_real( var.ref ) << '\n';
+						for ( auto const & var : fmu_outs ) {
+							f_out( i++, tOut, FMU::get_real( var.ref ) );
 						}
 					}
 				}
@@ -502,79 +721,145 @@ simulate()
 			}
 		}
 		if ( t <= tE ) { // Perform event
+			counters::Scope const counters_scope( counters::Derivative ); // Exclusive of nested queue, root, and output phases
 			++n_requant_events;
-			fmi2_import_set_time( fmu, t );
+			FMU::set_time( t );
+			bool zc_event( false ); // Zero-crossing occurred?
 			if ( events.simultaneous() ) { // Simultaneous trigger
 				if ( options::output::d ) std::cout << "Simultaneous trigger event at t = " << t << std::endl;
 				EventQueue< Variable >::Variables triggers( events.simultaneous_variables() ); // Chg to generator approach to avoid heap hit
+				EventQueue< Variable >::Variables zc_triggers; // Zero-crossing triggers: Advanced after the QSS requantizations
+				if ( n_zcs > 0u ) {
+					auto const i_zc( std::stable_partition( triggers.begin(), triggers.end(), []( Variable const * v ){ return ! v->is_ZC(); } ) );
+					zc_triggers.assign( i_zc, triggers.end() );
+					triggers.erase( i_zc, triggers.end() );
+				}
 				for ( Variable * trigger : triggers ) {
 					assert( trigger->tE == t );
+					trace::Scope const scope( trace::Phase::Advance0 );
 					trigger->advance0();
 				}
 				for ( Variable * trigger : triggers ) {
+					trace::Scope const scope( trace::Phase::Advance1 );
 					trigger->advance1_fmu();
 				}
 				for ( Variable * trigger : triggers ) {
+					trace::Scope const scope( trace::Phase::Advance1 );
 					trigger->advance1_LIQSS();
 				}
 				for ( Variable * trigger : triggers ) {
+					trace::Scope const scope( trace::Phase::Advance1 );
 					trigger->advance1();
 				}
 				for ( Variable * trigger : triggers ) {
-					trigger->advance_observers();
+					static_cast< Variable_FMU * >( trigger )->advance_observers_fmu();
+					n_observer_advances += trigger->observers().size();
 				}
 				if ( QSS_order_max >= 2 ) {
 					Time const tQ( t );
-					fmi2_import_set_time( fmu, t += options::dtND ); //API Numeric differentiation
+					FMU::set_time( t += options::dtND ); //API Numeric differentiation
 					for ( Variable * trigger : triggers ) {
+						trace::Scope const scope( trace::Phase::Advance2 );
 						trigger->advance2_fmu( t );
 					}
 					for ( Variable * trigger : triggers ) {
+						trace::Scope const scope( trace::Phase::Advance2 );
 						trigger->advance2_LIQSS();
 					}
 					for ( Variable * trigger : triggers ) {
+						trace::Scope const scope( trace::Phase::Advance2 );
 						trigger->advance2();
 					}
 					for ( Variable * trigger : triggers ) {
-						trigger->advance_observers_2( t );
+						static_cast< Variable_FMU * >( trigger )->advance_observers_2_fmu( t );
 					}
 					if ( QSS_order_max >= 3 ) {
 						for ( Variable * trigger : triggers ) {
+							trace::Scope const scope( trace::Phase::Advance3 );
 							trigger->advance3();
 						}
 					}
 					t = tQ;
 				}
+				if ( n_zcs > 0u ) { // Zero-crossing variables: Event indicators at the requantized trajectories
+					indicators.advance( t );
+					n_observer_advances += n_zcs - zc_triggers.size();
+					for ( Variable * trigger : zc_triggers ) {
+						Variable_FMU_ZC * zc( static_cast< Variable_FMU_ZC * >( trigger ) );
+						zc->advance();
+#ifdef QSS_STATS
+						zc->stats_requant( true );
+#endif
+						if ( zc->crossed() ) zc_event = true;
+					}
+				}
+#ifdef QSS_STATS
+				for ( Variable * trigger : triggers ) {
+					trigger->stats_requant( true );
+				}
+#endif
 				if ( doROut ) { // Requantization output
+					trace::Scope const scope( trace::Phase::Output );
+					counters::Scope const counters_scope( counters::Output );
 					for ( Variable * trigger : triggers ) {
 						if ( options::output::a ) { // All variables output
-							for ( size_type i = 0; i < n_vars; ++i ) {
-								if ( options::output::x ) x_streams[ i ] << t << '\t' << vars[ i ]->x( t ) << '\n';
-								if ( options::output::q ) q_streams[ i ] << t << '\t' << vars[ i ]->q( t ) << '\n';
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( options::output::x ) x_out.requant( i, t, out_vars[ i ]->x( t ) );
+								if ( options::output::q ) q_out.requant( i, t, out_vars[ i ]->q( t ) );
 							}
-						} else { // Trigger variable output
-							size_type const i( qss_vars[ trigger ] );
-							if ( options::output::x ) x_streams[ i ] << t << '\t' << trigger->x( t ) << '\n';
-							if ( options::output::q ) q_streams[ i ] << t << '\t' << trigger->q( t ) << '\n';
+						} else if ( trigger->out() ) { // Trigger variable output
+							size_type const i( trigger->i_out );
+							if ( options::output::x ) x_out.requant( i, t, trigger->x( t ) );
+							if ( options::output::q ) q_out.requant( i, t, trigger->q( t ) );
 						}
 					}
 				}
+				if ( sampler || segments ) { // Sampled output and trajectory segments tracking
+					for ( Variable * trigger : triggers ) {
+						changed_trigger( trigger );
+					}
+				}
 			} else { // Single trigger
 				Variable * trigger( events.top() );
 				assert( trigger->tE == t );
-				trigger->advance();
-				if ( doROut ) { // Requantization output
+				bool const zc_trigger( ( n_zcs > 0u ) && trigger->is_ZC() );
+				if ( zc_trigger ) indicators.advance( t ); // Zero-crossing trigger trajectory is set with the other indicators
+				{
+					trace::Scope const scope( trace::Phase::Advance );
+					trigger->advance();
+				}
+				n_observer_advances += trigger->observers().size();
+				if ( ( n_zcs > 0u ) && ( ! zc_trigger ) ) { // Zero-crossing variables: Event indicators at the requantized trajectory
+					indicators.advance( t );
+					n_observer_advances += n_zcs;
+				} else if ( zc_trigger ) {
+					n_observer_advances += n_zcs - 1u;
+				}
+#ifdef QSS_STATS
+				trigger->stats_requant();
+#endif
+				if ( zc_trigger ) { // Zero-crossing trigger
+					if ( static_cast< Variable_FMU_ZC * >( trigger )->crossed() ) zc_event = true;
+				} else if ( doROut ) { // Requantization output
+					trace::Scope const scope( trace::Phase::Output );
+					counters::Scope const counters_scope( counters::Output );
 					if ( options::output::a ) { // All variables output
-						for ( size_type i = 0; i < n_vars; ++i ) {
-							if ( options::output::x ) x_streams[ i ] << t << '\t' << vars[ i ]->x( t ) << '\n';
-							if ( options::output::q ) q_streams[ i ] << t << '\t' << vars[ i ]->q( t ) << '\n';
+						for ( size_type i = 0; i < n_out_vars; ++i ) {
+							if ( options::output::x ) x_out.requant( i, t, out_vars[ i ]->x( t ) );
+							if ( options::output::q ) q_out.requant( i, t, out_vars[ i ]->q( t ) );
 						}
-					} else { // Trigger variable output
-						size_type const i( qss_vars[ trigger ] );
-						if ( options::output::x ) x_streams[ i ] << t << '\t' << trigger->x( t ) << '\n';
-						if ( options::output::q ) q_streams[ i ] << t << '\t' << trigger->q( t ) << '\n';
+					} else if ( trigger->out() ) { // Trigger variable output
+						size_type const i( trigger->i_out );
+						if ( options::output::x ) x_out.requant( i, t, trigger->x( t ) );
+						if ( options::output::q ) q_out.requant( i, t, trigger->q( t ) );
 					}
 				}
+				if ( ( sampler || segments ) && ( ! trigger->is_ZC() ) ) changed_trigger( trigger ); // Sampled output and trajectory segments tracking
+			}
+			if ( zc_event ) { // FMU event processing at zero-crossing
+				++n_zc_events;
+				if ( options::output::d ) std::cout << "Zero-crossing event at t = " << t << std::endl;
+				fmu_event( t );
 			}
 		}
 
@@ -585,22 +870,56 @@ simulate()
 //			states[ i ] = vars[ i ]->x( t );
 //		}
 //		fmi2_import_set_continuous_states( fmu, states, n_states );
-		fmi2_import_completed_integrator_step( fmu, fmi2_true, &callEventUpdate, &terminateSimulation );
+		if ( cis_needed ) { // Called at event time t: Sampled mode calls at the first event after each sampled output time
+			if ( ( ( cis_interval > 0u ) && ( ++n_cis_events >= cis_interval ) ) || sampled ) { // Batched calls
+				fmi2_import_completed_integrator_step( fmu, fmi2_true, &callEventUpdate, &terminateSimulation );
+				n_cis_events = 0u;
+				if ( callEventUpdate && ( t <= tE ) && ( ! terminateSimulation ) ) { // FMU requested event mode
+					++n_cis_event_updates;
+					if ( options::output::d ) std::cout << "Completed integrator step event at t = " << t << std::endl;
+					fmu_event( t );
+				}
+			}
+		}
 		if ( eventInfo.terminateSimulation || terminateSimulation ) break;
 	}
+	if ( trace::on ) trace::stop();
+#ifdef QSS_STATS
+	counters::Counts const counts( counting ? counters::stop() : counters::Counts() );
+#endif
+
+	// Memory footprint before outputs close
+	Memory memory;
+	memory.n_variables = vars.size() + zcs.size();
+	for ( auto var : vars ) {
+		var->memory( memory );
+		memory.n_edges += var->observers().size();
+	}
+	for ( auto zc : zcs ) {
+		zc->memory( memory );
+		memory.n_edges += n_states; // Event indicators depend on all QSS variables
+	}
+	memory.add( Memory::Variables, Memory::heap( vars ) + Memory::heap( outs ) + Memory::heap( out_vars ) + Memory::heap( zcs ) );
+	indicators.memory( memory );
+	memory.add( Memory::Event_Queue, events.heap_bytes() );
+	memory.add( Memory::Outputs, x_out.heap_bytes() + q_out.heap_bytes() + f_out.heap_bytes() + ( sink != nullptr ? sink->heap_bytes() : 0u ) + ( stream ? stream->heap_bytes() : 0u ) + ( queue ? queue->heap_bytes() : 0u ) + ( sampler ? sampler->heap_bytes() : 0u ) + ( segments ? segments->heap_bytes() : 0u ) );
+	memory.add( Memory::FMU, ( 2u * Memory::block( n_states * sizeof( fmi2_real_t ) ) ) + Memory::block( FMU::n_ders * sizeof( fmi2_real_t ) ) + Memory::block( FMU::n_event_indicators * sizeof( fmi2_real_t ) ) + Memory::heap( FMU::fmus ) ); // States, derivatives, and event indicators arrays
+	memory.add( Memory::FMU, Memory::heap( fmu_vars ) + Memory::heap( fmu_outs ) + Memory::heap( tables.reals ) + Memory::heap( tables.outs ) + Memory::heap( tables.ders ) + Memory::heap( tables.states ) + Memory::heap( tables.dep_start ) + Memory::heap( tables.deps ) + Memory::heap( tables.dep_kinds ) + Memory::heap( fmu_qss ) + Memory::heap( der_qss ) ); // FMU variable lookups
+
+	if ( segments ) segments->close( std::min( t, tE ) );
 
 	// tE QSS outputs and streams close
 	if ( ( options::output::r || options::output::s ) && ( options::output::x || options::output::q ) ) {
-		for ( size_type i = 0; i < n_vars; ++i ) {
-			Variable const * var( vars[ i ] );
+		for ( size_type i = 0; i < n_out_vars; ++i ) {
+			Variable const * var( out_vars[ i ] );
 			if ( var->tQ < tE ) {
 				if ( options::output::x ) {
-					x_streams[ i ] << tE << '\t' << var->x( tE ) << '\n';
-					x_streams[ i ].close();
+					x_out( i, tE, var->x( tE ) );
+					x_out.close( i );
 				}
 				if ( options::output::q ) {
-					q_streams[ i ] << tE << '\t' << var->q( tE ) << '\n';
-					q_streams[ i ].close();
+					q_out( i, tE, var->q( tE ) );
+					q_out.close( i );
 				}
 			}
 		}
@@ -611,8 +930,8 @@ simulate()
 		if ( n_outs > 0u ) { // FMU QSS variable outputs
 			for ( size_type i = 0; i < n_outs; ++i ) {
 				Variable * var( outs[ i ] );
-				f_streams[ i ] << tE << '\t' << var->x( tE ) << '\n';
-				f_streams[ i ].close();
+				f_out( i, tE, var->x( tE ) );
+				f_out.close( i );
 			}
 		}
 		if ( n_fmu_outs > 0u ) { // FMU (non-QSS) variable outputs
@@ -622,34 +941,100 @@ simulate()
 			}
 			fmi2_import_set_continuous_states( fmu, states, n_states );
 			size_type i( n_outs );
-			for ( auto const & e : fmu_outs ) {
-				FMU_Variable const & var( e.second );
-				f_streams[ i ] << tE << '\t' << FMU::get_real( var.ref ) << '\n';
-				f_streams[ i++ ].close();
+			for ( auto const & var : fmu_outs ) {
+				f_out( i, tE, FMU::get_real( var.ref ) );
+				f_out.close( i++ );
 			}
 		}
 	}
 
+	// Asynchronous output completion
+	if ( queue ) {
+		queue->stop();
+		if ( queue->n_blocked() > 0u ) std::cout << "Output queue full " << queue->n_blocked() << " times: Solver waited for writer" << std::endl;
+		if ( queue->n_dropped() > 0u ) std::cerr << "Warning: Output queue full: " << queue->n_dropped() << " requantization output records dropped: Sampled outputs are complete" << std::endl;
+	}
+
+	// Live output stream completion
+	if ( stream ) {
+		stream->close();
+		if ( stream->n_dropped() > 0u ) std::cout << "Output stream: " << stream->n_dropped() << " records dropped while no monitor was connected or it lagged" << std::endl;
+	}
+
 	// Reporting
 	std::cout << "Simulation complete" << std::endl;
 	std::cout << n_requant_events << " total requantization events occurred" << std::endl;
+	std::cout << n_observer_advances << " total observer advances occurred" << std::endl;
+	if ( n_zcs > 0u ) std::cout << n_zc_events << " zero-crossing events occurred" << std::endl;
+	if ( n_cis_event_updates > 0u ) std::cout << n_cis_event_updates << " completed integrator step event updates occurred" << std::endl;
+	memory_summary( memory, std::cout );
+	if ( options::memory ) memory_report( memory, std::cout );
+#ifdef QSS_STATS
+	Variable::Variables stats_vars( vars.begin(), vars.end() ); // QSS and zero-crossing variables
+	stats_vars.insert( stats_vars.end(), zcs.begin(), zcs.end() );
+	stats_report( stats_vars, options::stats, std::cout );
+	if ( counting ) counters::report( counts, std::cout );
+#endif
+
+	// QSS and FMI Library cleanup: Resources destructor
+}
 
-	// QSS cleanup
-	for ( auto & var : vars ) delete var;
-	FMU::cleanup();
-
-	// FMI Library cleanup
-	fmi2_import_terminate( fmu );
-	fmi2_import_free_instance( fmu );
-	std::free( states );
-	std::free( states_der );
-	std::free( event_indicators );
-	std::free( event_indicators_prev );
-	std::free( var_list );
-	std::free( der_list );
-	fmi2_import_destroy_dllfmu( fmu );
-	fmi2_import_free( fmu );
-	fmi_import_free_context( context );
+// Model Structure Tables from the XML
+Tables
+tables_of_xml( fmi2_import_t * fmu, fmi2_import_variable_list_t * var_list, fmi2_import_variable_list_t * der_list )
+{
+	using size_type = std::size_t;
+	using RVR_Idx = std::pair< fmi2_import_real_variable_t *, size_type >; // FMU real variable and its index
+	using RVR_Idxs = std::vector< RVR_Idx >; // FMU real variables and their indexes sorted for lookup
+
+	// Variables
+	Tables tables;
+	size_type const n_fmu_vars( fmi2_import_get_variable_list_size( var_list ) );
+	tables.n_fmu_vars = n_fmu_vars;
+	RVR_Idxs rvr_idxs; // FMU continuous real variable pointer to index lookup
+	rvr_idxs.reserve( n_fmu_vars );
+	for ( size_type i = 0; i < n_fmu_vars; ++i ) {
+		fmi2_import_variable_t * var( fmi2_import_get_variable( var_list, i ) );
+		if ( fmi2_import_get_variable_base_type( var ) == fmi2_base_type_real ) {
+			if ( fmi2_import_get_variability( var ) == fmi2_variability_enu_continuous ) {
+				tables.reals.push_back( i );
+				rvr_idxs.emplace_back( fmi2_import_get_variable_as_real( var ), i );
+			}
+			if ( fmi2_import_get_causality( var ) == fmi2_causality_enu_output ) tables.outs.push_back( i );
+		}
+	}
+	std::sort( rvr_idxs.begin(), rvr_idxs.end() );
+	auto rvr_idx = [&]( fmi2_import_real_variable_t * const rvr ) -> size_type { // Index of FMU continuous real variable or n_fmu_vars if not present
+		auto const i( std::lower_bound( rvr_idxs.begin(), rvr_idxs.end(), RVR_Idx( rvr, 0u ) ) );
+		return ( ( i != rvr_idxs.end() ) && ( i->first == rvr ) ? i->second : n_fmu_vars );
+	};
+
+	// Derivatives
+	size_type const n_ders( fmi2_import_get_variable_list_size( der_list ) );
+	tables.ders.assign( n_ders, Tables::none );
+	tables.states.assign( n_ders, Tables::none );
+	for ( size_type i = 0; i < n_ders; ++i ) {
+		fmi2_import_variable_t * der( fmi2_import_get_variable( der_list, i ) );
+		if ( fmi2_import_get_variable_base_type( der ) == fmi2_base_type_real ) {
+			fmi2_import_real_variable_t * der_real( fmi2_import_get_variable_as_real( der ) );
+			fmi2_import_real_variable_t * var_real( fmi2_import_get_real_variable_derivative_of( der_real ) );
+			tables.ders[ i ] = rvr_idx( der_real );
+			tables.states[ i ] = ( var_real != nullptr ? rvr_idx( var_real ) : n_fmu_vars );
+		}
+	}
+
+	// Dependencies
+	size_type * startIndex( nullptr );
+	size_type * dependency( nullptr );
+	char * factorKind( nullptr );
+	fmi2_import_get_derivatives_dependencies( fmu, &startIndex, &dependency, &factorKind );
+	if ( startIndex != nullptr ) { // Dependency info present in XML
+		tables.has_deps = true;
+		tables.dep_start.assign( startIndex, startIndex + n_ders + 1u );
+		tables.deps.assign( dependency, dependency + startIndex[ n_ders ] );
+		tables.dep_kinds.assign( factorKind, factorKind + startIndex[ n_ders ] );
+	}
+	return tables;
 }
 
 // Discrete Event Processing
@@ -663,4 +1048,162 @@ do_event_iteration( fmi2_import_t * fmu, fmi2_event_info_t * eventInfo )
 	}
 }
 
+// Variable Specs Output
+void
+dump_variable( fmi2_import_variable_t * var, std::size_t const idx, fmi2_value_reference_t const ref )
+{
+	std::cout << "\nVariable  Index: " << idx << " Ref: " << ref << '\n';
+	std::cout << " Name: " << fmi2_import_get_variable_name( var ) << '\n';
+	std::cout << " Desc: " << ( fmi2_import_get_variable_description( var ) ? fmi2_import_get_variable_description( var ) : "" ) << '\n';
+	std::cout << " Ref: " << fmi2_import_get_variable_vr( var ) << '\n';
+	bool const var_start( fmi2_import_get_variable_has_start( var ) == 1 );
+	std::cout << " Start? " << var_start << '\n';
+	switch ( fmi2_import_get_variable_base_type( var ) ) {
+	case fmi2_base_type_real:
+		std::cout << " Type: Real" << '\n';
+		if ( var_start ) std::cout << " Start: " << fmi2_import_get_real_variable_start( fmi2_import_get_variable_as_real( var ) ) << '\n';
+		break;
+	case fmi2_base_type_int:
+		std::cout << " Type: Integer" << '\n';
+		if ( var_start ) std::cout << " Start: " << fmi2_import_get_integer_variable_start( fmi2_import_get_variable_as_integer( var ) ) << '\n';
+		break;
+	case fmi2_base_type_bool:
+		std::cout << " Type: Boolean" << '\n';
+		if ( var_start ) std::cout << " Start: " << fmi2_import_get_boolean_variable_start( fmi2_import_get_variable_as_boolean( var ) ) << '\n';
+		break;
+	case fmi2_base_type_str:
+		std::cout << " Type: String" << '\n';
+		if ( var_start ) std::cout << " Start: " << fmi2_import_get_string_variable_start( fmi2_import_get_variable_as_string( var ) ) << '\n';
+		break;
+	case fmi2_base_type_enum:
+		std::cout << " Type: Enum" << '\n';
+		if ( var_start ) std::cout << " Start: " << fmi2_import_get_enum_variable_start( fmi2_import_get_variable_as_enum( var ) ) << '\n';
+		break;
+	default:
+		std::cout << " Type: Unknown" << '\n';
+		break;
+	}
+	fmi2_variability_enu_t const var_variability( fmi2_import_get_variability( var ) );
+	if ( var_variability == fmi2_variability_enu_constant ) {
+		std::cout << " Variability: Constant" << '\n';
+	} else if ( var_variability == fmi2_variability_enu_fixed ) {
+		std::cout << " Variability: Fixed" << '\n';
+	} else if ( var_variability == fmi2_variability_enu_tunable ) {
+		std::cout << " Variability: Tunable" << '\n';
+	} else if ( var_variability == fmi2_variability_enu_discrete ) {
+		std::cout << " Variability: Discrete" << '\n';
+	} else if ( var_variability == fmi2_variability_enu_continuous ) {
+		std::cout << " Variability: Continuous" << '\n';
+	} else if ( var_variability == fmi2_variability_enu_unknown ) {
+		std::cout << " Variability: Unknown" << '\n';
+	}
+	fmi2_causality_enu_t const var_causality( fmi2_import_get_causality( var ) );
+	if ( var_causality == fmi2_causality_enu_parameter ) {
+		std::cout << " Causality: Parameter" << '\n';
+	} else if ( var_causality == fmi2_causality_enu_calculated_parameter ) {
+		std::cout << " Causality: Calculated Parameter" << '\n';
+	} else if ( var_causality == fmi2_causality_enu_input ) {
+		std::cout << " Causality: Input" << '\n';
+	} else if ( var_causality == fmi2_causality_enu_output ) {
+		std::cout << " Causality: Output" << '\n';
+	} else if ( var_causality == fmi2_causality_enu_local ) {
+		std::cout << " Causality: Local" << '\n';
+	} else if ( var_causality == fmi2_causality_enu_independent ) {
+		std::cout << " Causality: Independent" << '\n';
+	} else if ( var_causality == fmi2_causality_enu_unknown ) {
+		std::cout << " Causality: Unknown" << '\n';
+	}
+	fmi2_initial_enu_t const var_initial( fmi2_import_get_initial( var ) );
+	if ( var_initial == fmi2_initial_enu_exact ) {
+		std::cout << " Initial: Exact" << '\n';
+	} else if ( var_initial == fmi2_initial_enu_approx ) {
+		std::cout << " Initial: Approx" << '\n';
+	} else if ( var_initial == fmi2_initial_enu_calculated ) {
+		std::cout << " Initial: Calculated" << '\n';
+	} else if ( var_initial == fmi2_initial_enu_unknown ) {
+		std::cout << " Initial: Unknown" << '\n';
+	}
+}
+
+// Derivative Specs Output
+void
+dump_derivative( fmi2_import_variable_t * der, fmi2_value_reference_t const ref )
+{
+	std::cout << "\nDerivative  Ref: " << ref << '\n';
+	std::cout << " Name: " << fmi2_import_get_variable_name( der ) << '\n';
+	std::cout << " Desc: " << ( fmi2_import_get_variable_description( der ) ? fmi2_import_get_variable_description( der ) : "" ) << '\n';
+	std::cout << " Ref: " << fmi2_import_get_variable_vr( der ) << '\n';
+	bool const der_start( fmi2_import_get_variable_has_start( der ) == 1 );
+	std::cout << " Start? " << der_start << '\n';
+	switch ( fmi2_import_get_variable_base_type( der ) ) {
+	case fmi2_base_type_real:
+		std::cout << " Type: Real" << '\n';
+		if ( der_start ) std::cout << " Start: " << fmi2_import_get_real_variable_start( fmi2_import_get_variable_as_real( der ) ) << '\n';
+		break;
+	case fmi2_base_type_int:
+		std::cout << " Type: Integer" << '\n';
+		if ( der_start ) std::cout << " Start: " << fmi2_import_get_integer_variable_start( fmi2_import_get_variable_as_integer( der ) ) << '\n';
+		break;
+	case fmi2_base_type_bool:
+		std::cout << " Type: Boolean" << '\n';
+		if ( der_start ) std::cout << " Start: " << fmi2_import_get_boolean_variable_start( fmi2_import_get_variable_as_boolean( der ) ) << '\n';
+		break;
+	case fmi2_base_type_str:
+		std::cout << " Type: String" << '\n';
+		if ( der_start ) std::cout << " Start: " << fmi2_import_get_string_variable_start( fmi2_import_get_variable_as_string( der ) ) << '\n';
+		break;
+	case fmi2_base_type_enum:
+		std::cout << " Type: Enum" << '\n';
+		if ( der_start ) std::cout << " Start: " << fmi2_import_get_enum_variable_start( fmi2_import_get_variable_as_enum( der ) ) << '\n';
+		break;
+	default:
+		std::cout << " Type: Unknown" << '\n';
+		break;
+	}
+}
+
+// Derivative Dependency Specs Output
+void
+dump_dependency( std::size_t const dep_idx, fmi2_dependency_factor_kind_enu_t const kind )
+{
+	std::cout << "  Dep Index: " << dep_idx << "  Kind: " << kind << '\n';
+	if ( dep_idx != 0 ) {
+		if ( kind == fmi2_dependency_factor_kind_dependent ) {
+			std::cout << "  Kind: Dependent" << '\n';
+		} else if ( kind == fmi2_dependency_factor_kind_constant ) {
+			std::cout << "  Kind: Constant" << '\n';
+		} else if ( kind == fmi2_dependency_factor_kind_fixed ) {
+			std::cout << "  Kind: Fixed" << '\n';
+		} else if ( kind == fmi2_dependency_factor_kind_tunable ) {
+			std::cout << "  Kind: Tunable" << '\n';
+		} else if ( kind == fmi2_dependency_factor_kind_discrete ) {
+			std::cout << "  Kind: Discrete" << '\n';
+		} else if ( kind == fmi2_dependency_factor_kind_num ) {
+			std::cout << "  Kind: Num" << '\n';
+		}
+	}
+}
+
+// Causality Name as in the Model Description XML
+std::string
+causality_name( fmi2_causality_enu_t const causality )
+{
+	switch ( causality ) {
+	case fmi2_causality_enu_parameter:
+		return "parameter";
+	case fmi2_causality_enu_calculated_parameter:
+		return "calculatedParameter";
+	case fmi2_causality_enu_input:
+		return "input";
+	case fmi2_causality_enu_output:
+		return "output";
+	case fmi2_causality_enu_local:
+		return "local";
+	case fmi2_causality_enu_independent:
+		return "independent";
+	default:
+		return "unknown";
+	}
+}
+
 } // FMU
@@ -11,6 +11,7 @@
 
 // QSS Headers
 #include <QSS/math.hh>
+#include <QSS/Memory.hh>
 
 // C++ Headers
 //#include <algorithm> // std::stable_sort
@@ -262,6 +263,13 @@ public: // Properties
 		return AdvanceSpecs_LIQSS2{ vl, vu, z1, sl, su, z2 };
 	}
 
+	// Heap Bytes
+	Memory::size_type
+	heap_bytes() const
+	{
+		return Memory::heap( c_ ) + Memory::heap( x_ ) + Memory::heap( co_ ) + Memory::heap( xo_ );
+	}
+
 public: // Methods
 
 	// Add Constant
@@ -350,6 +358,14 @@ public: // Methods
 		return *this;
 	}
 
+	// Reserve Capacity for n Variables
+	void
+	reserve( size_type const n )
+	{
+		c_.reserve( n );
+		x_.reserve( n );
+	}
+
 	// Finalize Function Representation
 	bool
 	finalize( Variable * v )
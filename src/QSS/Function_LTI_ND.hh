@@ -9,6 +9,9 @@
 // under contract to the National Renewable Energy Laboratory
 // of the U.S. Department of Energy
 
+// QSS Headers
+#include <QSS/Memory.hh>
+
 // C++ Headers
 //#include <algorithm> // std::stable_sort
 #include <cassert>
@@ -162,6 +165,13 @@ public: // Properties
 		return dtn_;
 	}
 
+	// Heap Bytes
+	Memory::size_type
+	heap_bytes() const
+	{
+		return Memory::heap( c_ ) + Memory::heap( x_ );
+	}
+
 public: // Methods
 
 	// Add Constant
@@ -11,6 +11,7 @@
 
 // C++ Headers
 #include <cassert>
+#include <cstddef>
 
 // Linear Time-Invariant Function
 template< typename V > // Template to avoid cyclic inclusion with Variable
@@ -98,6 +99,13 @@ public: // Properties
 		return q2( t );
 	}
 
+	// Heap Bytes
+	std::size_t
+	heap_bytes() const
+	{
+		return 0u; // No heap storage
+	}
+
 public: // Methods
 
 	// Set Variables
@@ -19,6 +19,7 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 
 // Derivative Function for Nonlinear Example
 template< typename V > // Template to avoid cyclic inclusion with Variable
@@ -197,6 +198,13 @@ public: // Properties
 		return std::sqrt( ( 2.0 * t * ( t + 1.0 ) ) + 16.0 ) - 2.0;
 	}
 
+	// Heap Bytes
+	std::size_t
+	heap_bytes() const
+	{
+		return 0u; // No heap storage
+	}
+
 public: // Methods
 
 	// Set Variable
@@ -12,6 +12,7 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 
 // Sine Function
 class Function_sin
@@ -125,6 +126,13 @@ public: // Properties
 		return d3( t );
 	}
 
+	// Heap Bytes
+	std::size_t
+	heap_bytes() const
+	{
+		return 0u; // No heap storage
+	}
+
 public: // Methods
 
 	// Set Value Scaling
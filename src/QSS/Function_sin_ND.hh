@@ -15,6 +15,7 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 
 // Sine Function Using Numeric Differentiation
 class Function_sin_ND
@@ -135,6 +136,13 @@ public: // Properties
 		return dtn_;
 	}
 
+	// Heap Bytes
+	std::size_t
+	heap_bytes() const
+	{
+		return 0u; // No heap storage
+	}
+
 public: // Methods
 
 	// Set Value Scaling
@@ -0,0 +1,73 @@
+// QSS Memory Footprint Accounting
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Memory.hh>
+
+// C++ Headers
+#include <iomanip>
+#include <iostream>
+
+namespace { // Internal
+
+// Subsystem Names
+char const * const subsystem_names[ Memory::n_subsystems ] = {
+ "variables",
+ "names",
+ "observers",
+ "functions",
+ "event_queue",
+ "outputs",
+ "fmu"
+};
+
+// Bytes per Item
+double
+per( Memory::size_type const bytes, Memory::size_type const n )
+{
+	return ( n > 0u ? double( bytes ) / double( n ) : 0.0 );
+}
+
+} // Internal
+
+// Memory Subsystem Name
+char const *
+memory_name( Memory::Subsystem const s )
+{
+	return subsystem_names[ s ];
+}
+
+// Memory Summary Line
+void
+memory_summary( Memory const & m, std::ostream & stream )
+{
+	std::ios_base::fmtflags const flags( stream.flags() );
+	std::streamsize const precision( stream.precision() );
+	stream << std::fixed << std::setprecision( 1 );
+	stream << "Memory: " << double( m.total() ) / 1024.0 << " KiB estimated heap for " << m.n_variables << " variables and " << m.n_edges << " observer edges: " << per( m.total(), m.n_variables ) << " B/variable" << std::endl;
+	stream.flags( flags );
+	stream.precision( precision );
+}
+
+// Memory Report by Subsystem
+void
+memory_report( Memory const & m, std::ostream & stream )
+{
+	std::ios_base::fmtflags const flags( stream.flags() );
+	std::streamsize const precision( stream.precision() );
+	stream << "\nMemory footprint by subsystem (estimated heap bytes)\n";
+	stream << "  " << std::left << std::setw( 12 ) << "subsystem" << std::right << std::setw( 16 ) << "bytes" << std::setw( 14 ) << "B/variable" << std::setw( 14 ) << "B/edge" << '\n';
+	stream << std::fixed << std::setprecision( 1 );
+	for ( Memory::size_type s = 0; s <= Memory::n_subsystems; ++s ) { // Subsystems then total
+		Memory::size_type const bytes( s < Memory::n_subsystems ? m.bytes[ s ] : m.total() );
+		stream << "  " << std::left << std::setw( 12 ) << ( s < Memory::n_subsystems ? subsystem_names[ s ] : "total" ) << std::right << std::setw( 16 ) << bytes << std::setw( 14 ) << per( bytes, m.n_variables ) << std::setw( 14 ) << per( bytes, m.n_edges ) << '\n';
+	}
+	stream.flags( flags );
+	stream.precision( precision );
+	stream << std::endl;
+}
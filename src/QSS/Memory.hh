@@ -0,0 +1,129 @@
+#ifndef QSS_Memory_hh_INCLUDED
+#define QSS_Memory_hh_INCLUDED
+
+// QSS Memory Footprint Accounting
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Heap bytes are estimated from object sizes and container capacities: Nothing is tracked while the solver runs
+// Each allocation is charged as a glibc-style heap chunk: Request plus a size word rounded up to 16 bytes, at least 32
+// Event queue nodes are charged as their value plus a red-black tree node header of 4 words (color and 3 links)
+// Strings within the short string optimization capacity have no heap block
+// File output streams are charged a BUFSIZ buffer each: Memory-mapped output chunks are file-backed and not counted
+// Memory allocated inside FMUs and the FMI Library is not visible here
+
+// C++ Headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Memory Footprint by Subsystem
+struct Memory
+{
+	using size_type = std::size_t;
+
+	// Subsystems
+	enum Subsystem {
+	 Variables, // Variable objects
+	 Names, // Variable name strings
+	 Observers, // Observer and observee vectors
+	 Functions, // Derivative function coefficient and variable vectors
+	 Event_Queue, // Event queue nodes
+	 Outputs, // Output channels, buffers, and streams
+	 FMU // FMU-side arrays
+	};
+	static size_type const n_subsystems = 7u;
+
+	// Heap Chunk Bytes of an n Byte Allocation
+	static
+	size_type
+	block( size_type const n )
+	{
+		return ( n == 0u ? 0u : std::max( size_type( 32u ), ( n + sizeof( size_type ) + 15u ) & ~size_type( 15u ) ) );
+	}
+
+	// Heap Bytes of a Vector
+	template< typename T >
+	static
+	size_type
+	heap( std::vector< T > const & v )
+	{
+		return block( v.capacity() * sizeof( T ) );
+	}
+
+	// Heap Bytes of a Bit Vector
+	static
+	size_type
+	heap( std::vector< bool > const & v )
+	{
+		return block( ( v.capacity() + 7u ) / 8u );
+	}
+
+	// Heap Bytes of a String
+	static
+	size_type
+	heap( std::string const & s )
+	{
+		return ( s.capacity() > std::string().capacity() ? block( s.capacity() + 1u ) : 0u );
+	}
+
+	// Heap Bytes of a String Vector
+	static
+	size_type
+	heap( std::vector< std::string > const & v )
+	{
+		size_type n( block( v.capacity() * sizeof( std::string ) ) );
+		for ( std::string const & s : v ) n += heap( s );
+		return n;
+	}
+
+	// Heap Bytes of a File Stream Buffer
+	static
+	size_type
+	stream_buffer()
+	{
+		return block( BUFSIZ );
+	}
+
+	// Add Bytes to a Subsystem
+	void
+	add( Subsystem const s, size_type const n )
+	{
+		bytes[ s ] += n;
+	}
+
+	// Total Bytes
+	size_type
+	total() const
+	{
+		size_type n( 0u );
+		for ( size_type const b : bytes ) n += b;
+		return n;
+	}
+
+	size_type bytes[ n_subsystems ] = {}; // Bytes by subsystem
+	size_type n_variables{ 0u }; // Variables
+	size_type n_edges{ 0u }; // Observer dependency edges
+
+};
+
+// Memory Subsystem Name
+char const *
+memory_name( Memory::Subsystem const s );
+
+// Memory Summary Line
+void
+memory_summary( Memory const & m, std::ostream & stream );
+
+// Memory Report by Subsystem
+void
+memory_report( Memory const & m, std::ostream & stream );
+
+#endif
@@ -0,0 +1,611 @@
+// QSS Model Description Files
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Model_File.hh>
+#include <QSS/options.hh>
+#include <QSS/Function_LTI.hh>
+#include <QSS/Function_sin.hh>
+#include <QSS/Variable_Inp1.hh>
+#include <QSS/Variable_Inp2.hh>
+#include <QSS/Variable_Inp3.hh>
+#include <QSS/Variable_LIQSS1.hh>
+#include <QSS/Variable_LIQSS2.hh>
+#include <QSS/Variable_QSS1.hh>
+#include <QSS/Variable_QSS2.hh>
+#include <QSS/Variable_QSS3.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+// POSIX Headers
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace { // Internal
+
+using size_type = std::size_t;
+using Variables = std::vector< Variable * >;
+
+// File Magic Tag
+char const magic[ 4 ] = { 'Q', 'S', 'S', 'D' };
+
+// File Format Version
+std::uint32_t const version( 1u );
+
+// Binary File Header
+struct Header
+{
+	char magic[ 4 ];
+	std::uint32_t version;
+	std::uint64_t n_vars;
+	std::uint64_t nnz;
+	std::uint64_t names_bytes;
+};
+
+static_assert( sizeof( Header ) == 32u, "Unexpected model file header size" );
+static_assert( sizeof( Model_Variable ) == 64u, "Unexpected model variable record size" );
+
+// QSS Method Names in options::QSS Order
+char const * const methods[] = { "QSS1", "QSS2", "QSS3", "LIQSS1", "LIQSS2", "LIQSS3" };
+std::uint8_t const n_methods( std::uint8_t( sizeof( methods ) / sizeof( methods[ 0 ] ) ) );
+
+// Model View: Arrays of a Loaded Text Model or a Mapped Binary File
+struct Model_View
+{
+	std::uint64_t n_vars{ 0u };
+	std::uint64_t nnz{ 0u };
+	Model_Variable const * vars{ nullptr };
+	std::uint64_t const * row_ptr{ nullptr };
+	double const * val{ nullptr };
+	std::uint32_t const * col{ nullptr };
+	char const * names{ nullptr };
+	std::uint64_t names_bytes{ 0u };
+};
+
+// Model View of a Description
+Model_View
+view_of( Model_Description const & model )
+{
+	Model_View view;
+	view.n_vars = model.vars.size();
+	view.nnz = model.val.size();
+	view.vars = model.vars.data();
+	view.row_ptr = model.row_ptr.data();
+	view.val = model.val.data();
+	view.col = model.col.data();
+	view.names = model.names.data();
+	view.names_bytes = model.names.size();
+	return view;
+}
+
+// Has Suffix?
+bool
+has_suffix( std::string const & s, std::string const & suffix )
+{
+	return ( s.length() > suffix.length() ) && ( s.compare( s.length() - suffix.length(), suffix.length(), suffix ) == 0 );
+}
+
+// QSS Method Code of a Name: 0 if Invalid
+std::uint8_t
+method_of( std::string const & name )
+{
+	std::string upper( name );
+	for ( char & c : upper ) c = char( std::toupper( static_cast< unsigned char >( c ) ) );
+	for ( std::uint8_t m = 0; m < n_methods; ++m ) {
+		if ( upper == methods[ m ] ) return std::uint8_t( m + 1u );
+	}
+	return 0u;
+}
+
+// Parse a Number: Returns Whether Valid
+bool
+number_of( std::string const & s, double & d )
+{
+	if ( s.empty() ) return false;
+	char * end( nullptr );
+	d = std::strtod( s.c_str(), &end );
+	return *end == '\0';
+}
+
+// Valid Variable Name?
+bool
+valid_name( std::string const & name )
+{
+	double d;
+	return ( ! name.empty() ) && ( name.length() <= std::numeric_limits< std::uint16_t >::max() ) && ( name.find_first_of( "*=" ) == std::string::npos ) && ( name[ 0 ] != '+' ) && ( name[ 0 ] != '-' ) && ( ! number_of( name, d ) );
+}
+
+// Text Model Reader
+class Text_Reader
+{
+
+public: // Creation
+
+	// Constructor
+	Text_Reader(
+	 std::string const & file_name,
+	 Model_Description & model
+	) :
+	 file_name_( file_name ),
+	 model_( model )
+	{}
+
+public: // Methods
+
+	// Read: Returns Whether Successful
+	bool
+	read()
+	{
+		std::ifstream stream( file_name_, std::ios_base::binary | std::ios_base::in );
+		if ( ! stream ) {
+			std::cerr << "Error: Model file could not be opened: " << file_name_ << std::endl;
+			return false;
+		}
+		std::ostringstream contents;
+		contents << stream.rdbuf();
+		std::string const text( contents.str() );
+
+		// Declarations pass: Derivatives are deferred so they can refer to variables declared later
+		model_ = Model_Description();
+		std::vector< std::string > tokens;
+		std::string::size_type b( 0u );
+		while ( b < text.length() ) {
+			++line_;
+			std::string::size_type e( text.find( '\n', b ) );
+			if ( e == std::string::npos ) e = text.length();
+			tokenize( text, b, e, tokens );
+			b = e + 1u;
+			if ( tokens.empty() ) continue;
+			std::string const & keyword( tokens[ 0 ] );
+			if ( keyword == "qss" ) {
+				if ( tokens.size() != 2u ) return error( "qss needs one method" );
+				method_ = method_of( tokens[ 1 ] );
+				if ( method_ == 0u ) return error( "Unknown QSS method: " + tokens[ 1 ] );
+			} else if ( ( keyword == "var" ) || ( keyword == "inp" ) ) {
+				if ( ! declare( tokens ) ) return false;
+			} else if ( keyword == "der" ) {
+				if ( tokens.size() < 2u ) return error( "der needs a variable name" );
+				ders_.emplace_back( line_, std::move( tokens ) );
+				tokens = std::vector< std::string >();
+			} else {
+				return error( "Unknown statement: " + keyword );
+			}
+		}
+
+		// Derivatives pass: Build the CSR rows
+		using Term = std::pair< std::uint32_t, double >;
+		std::vector< std::vector< Term > > rows( model_.vars.size() );
+		std::vector< bool > defined( model_.vars.size(), false );
+		for ( auto const & der : ders_ ) {
+			line_ = der.first;
+			std::vector< std::string > const & terms( der.second );
+			auto const i_row( index_.find( terms[ 1 ] ) );
+			if ( i_row == index_.end() ) return error( "der of undeclared variable: " + terms[ 1 ] );
+			std::uint32_t const r( i_row->second );
+			Model_Variable & var( model_.vars[ r ] );
+			if ( var.type != Model_Description::State ) return error( "der of input variable: " + terms[ 1 ] );
+			if ( defined[ r ] ) return error( "Duplicate der of variable: " + terms[ 1 ] );
+			defined[ r ] = true;
+			std::vector< Term > & row( rows[ r ] );
+			for ( size_type k = 2; k < terms.size(); ++k ) {
+				std::string const & term( terms[ k ] );
+				double coef( 1.0 ), constant;
+				std::string name;
+				std::string::size_type const star( term.find( '*' ) );
+				if ( star != std::string::npos ) { // COEF*NAME
+					if ( ! number_of( term.substr( 0u, star ), coef ) ) return error( "Invalid coefficient in term: " + term );
+					name = term.substr( star + 1u );
+				} else if ( number_of( term, constant ) ) { // Constant
+					var.c0 += constant;
+					continue;
+				} else if ( ( term[ 0 ] == '-' ) || ( term[ 0 ] == '+' ) ) { // -NAME or +NAME
+					coef = ( term[ 0 ] == '-' ? -1.0 : 1.0 );
+					name = term.substr( 1u );
+				} else { // NAME
+					name = term;
+				}
+				auto const i_col( index_.find( name ) );
+				if ( i_col == index_.end() ) return error( "Undeclared variable in term: " + term );
+				row.emplace_back( i_col->second, coef );
+			}
+		}
+
+		// CSR arrays: Columns sorted and repeated terms merged
+		model_.row_ptr.reserve( rows.size() + 1u );
+		model_.row_ptr.push_back( 0u );
+		for ( std::vector< Term > & row : rows ) {
+			std::sort( row.begin(), row.end(), []( Term const & a, Term const & b ){ return a.first < b.first; } );
+			for ( size_type k = 0; k < row.size(); ++k ) {
+				if ( ( k > 0u ) && ( row[ k ].first == model_.col.back() ) ) {
+					model_.val.back() += row[ k ].second;
+				} else {
+					model_.col.push_back( row[ k ].first );
+					model_.val.push_back( row[ k ].second );
+				}
+			}
+			model_.row_ptr.push_back( model_.val.size() );
+			std::vector< Term >().swap( row );
+		}
+		return true;
+	}
+
+private: // Methods
+
+	// Split [b,e) of Text into Whitespace-Separated Tokens up to Any # Comment
+	static
+	void
+	tokenize(
+	 std::string const & text,
+	 std::string::size_type b,
+	 std::string::size_type const e,
+	 std::vector< std::string > & tokens
+	)
+	{
+		tokens.clear();
+		while ( b < e ) {
+			while ( ( b < e ) && std::isspace( static_cast< unsigned char >( text[ b ] ) ) ) ++b;
+			if ( ( b < e ) && ( text[ b ] == '#' ) ) break;
+			std::string::size_type t( b );
+			while ( ( t < e ) && ( ! std::isspace( static_cast< unsigned char >( text[ t ] ) ) ) && ( text[ t ] != '#' ) ) ++t;
+			if ( t > b ) tokens.emplace_back( text, b, t - b );
+			b = t;
+		}
+	}
+
+	// Declare a Variable: Returns Whether Successful
+	bool
+	declare( std::vector< std::string > const & tokens )
+	{
+		bool const input( tokens[ 0 ] == "inp" );
+		if ( tokens.size() < 2u ) return error( tokens[ 0 ] + " needs a variable name" );
+		std::string const & name( tokens[ 1 ] );
+		if ( ! valid_name( name ) ) return error( "Invalid variable name: " + name );
+		if ( index_.find( name ) != index_.end() ) return error( "Duplicate variable: " + name );
+		if ( model_.vars.size() >= std::numeric_limits< std::uint32_t >::max() ) return error( "Too many variables" );
+		if ( model_.names.size() + name.length() > std::numeric_limits< std::uint32_t >::max() ) return error( "Variable names too long" );
+		size_type k( 2u );
+		if ( input ) {
+			if ( ( tokens.size() < 3u ) || ( tokens[ 2 ] != "sin" ) ) return error( "inp needs an input function: sin" );
+			++k;
+		}
+		Model_Variable var;
+		var.xIni = 0.0;
+		var.rTol = var.aTol = std::numeric_limits< double >::quiet_NaN();
+		var.dt_max = var.c0 = 0.0;
+		var.c = var.s = 1.0;
+		var.name_offset = std::uint32_t( model_.names.size() );
+		var.name_length = std::uint16_t( name.length() );
+		var.type = ( input ? Model_Description::Input : Model_Description::State );
+		var.method = method_;
+		for ( ; k < tokens.size(); ++k ) {
+			std::string const & key_value( tokens[ k ] );
+			std::string::size_type const eq( key_value.find( '=' ) );
+			if ( eq == std::string::npos ) return error( "Parameter is not key=value: " + key_value );
+			std::string const key( key_value.substr( 0u, eq ) );
+			std::string const value( key_value.substr( eq + 1u ) );
+			double d( 0.0 );
+			if ( key == "qss" ) {
+				var.method = method_of( value );
+				if ( var.method == 0u ) return error( "Unknown QSS method: " + value );
+				continue;
+			}
+			if ( ! number_of( value, d ) ) return error( "Invalid number: " + key_value );
+			if ( ( key == "xIni" ) && ( ! input ) ) {
+				var.xIni = d;
+			} else if ( key == "rTol" ) {
+				if ( d < 0.0 ) return error( "rTol must be nonnegative" );
+				var.rTol = d;
+			} else if ( key == "aTol" ) {
+				if ( d <= 0.0 ) return error( "aTol must be positive" );
+				var.aTol = d;
+			} else if ( key == "dtMax" ) {
+				if ( d <= 0.0 ) return error( "dtMax must be positive" );
+				var.dt_max = d;
+			} else if ( ( key == "c" ) && input ) {
+				var.c = d;
+			} else if ( ( key == "s" ) && input ) {
+				var.s = d;
+			} else {
+				return error( "Unknown parameter: " + key );
+			}
+		}
+		index_.emplace( name, std::uint32_t( model_.vars.size() ) );
+		model_.vars.push_back( var );
+		model_.names += name;
+		return true;
+	}
+
+	// Report Error: Returns false
+	bool
+	error( std::string const & msg ) const
+	{
+		std::cerr << "Error: Model file " << file_name_ << " line " << line_ << ": " << msg << std::endl;
+		return false;
+	}
+
+private: // Data
+
+	std::string file_name_; // Model file name
+	Model_Description & model_; // Model description
+	size_type line_{ 0u }; // Current line number
+	std::uint8_t method_{ 0u }; // QSS method for new variables: 0 => --qss
+	std::unordered_map< std::string, std::uint32_t > index_; // Variable name to index: Only needed while loading
+	std::vector< std::pair< size_type, std::vector< std::string > > > ders_; // Deferred der statements with line numbers
+
+};
+
+// Memory-Mapped Binary Model File
+class Mapped_Model
+{
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Mapped_Model( std::string const & file_name ) :
+	 file_name_( file_name )
+	{}
+
+	// Destructor
+	~Mapped_Model()
+	{
+#ifndef _WIN32
+		if ( map_ != nullptr ) ::munmap( map_, size_ );
+#endif
+	}
+
+public: // Methods
+
+	// Open and Validate: Returns Whether Successful
+	bool
+	open( Model_View & view )
+	{
+#ifndef _WIN32
+		int const fd( ::open( file_name_.c_str(), O_RDONLY ) );
+		if ( fd < 0 ) return error( "could not be opened" );
+		struct stat st;
+		if ( ( ::fstat( fd, &st ) != 0 ) || ( st.st_size < off_t( sizeof( Header ) ) ) ) {
+			::close( fd );
+			return error( "is too short" );
+		}
+		size_ = size_type( st.st_size );
+		void * map( ::mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0 ) );
+		::close( fd );
+		if ( map == MAP_FAILED ) return error( "could not be mapped" );
+		map_ = map;
+		char const * data( static_cast< char const * >( map_ ) );
+#else // Read into an 8-byte aligned buffer
+		std::ifstream stream( file_name_, std::ios_base::binary | std::ios_base::in | std::ios_base::ate );
+		if ( ! stream ) return error( "could not be opened" );
+		size_ = size_type( stream.tellg() );
+		if ( size_ < sizeof( Header ) ) return error( "is too short" );
+		buffer_.resize( ( size_ + 7u ) / 8u );
+		stream.seekg( 0 );
+		if ( ! stream.read( reinterpret_cast< char * >( buffer_.data() ), size_ ) ) return error( "could not be read" );
+		char const * data( reinterpret_cast< char const * >( buffer_.data() ) );
+#endif
+
+		// Header
+		Header header;
+		std::memcpy( &header, data, sizeof( Header ) );
+		if ( std::memcmp( header.magic, magic, sizeof( magic ) ) != 0 ) return error( "is not a binary model file" );
+		if ( header.version != version ) return error( "has unsupported version " + std::to_string( header.version ) );
+		std::uint64_t const n( header.n_vars ), nnz( header.nnz );
+		size_type const max_count( size_ / sizeof( std::uint32_t ) ); // Bounds counts so the size check can't overflow
+		if ( ( n > max_count ) || ( nnz > max_count ) || ( header.names_bytes > size_ ) || ( n > std::numeric_limits< std::uint32_t >::max() ) ) return error( "has invalid counts" );
+		if ( size_ != sizeof( Header ) + ( n * sizeof( Model_Variable ) ) + ( ( n + 1u ) * sizeof( std::uint64_t ) ) + ( nnz * ( sizeof( double ) + sizeof( std::uint32_t ) ) ) + header.names_bytes ) return error( "size doesn't match its header" );
+
+		// Arrays
+		view.n_vars = n;
+		view.nnz = nnz;
+		size_type offset( sizeof( Header ) );
+		view.vars = reinterpret_cast< Model_Variable const * >( data + offset );
+		offset += n * sizeof( Model_Variable );
+		view.row_ptr = reinterpret_cast< std::uint64_t const * >( data + offset );
+		offset += ( n + 1u ) * sizeof( std::uint64_t );
+		view.val = reinterpret_cast< double const * >( data + offset );
+		offset += nnz * sizeof( double );
+		view.col = reinterpret_cast< std::uint32_t const * >( data + offset );
+		offset += nnz * sizeof( std::uint32_t );
+		view.names = data + offset;
+		view.names_bytes = header.names_bytes;
+
+		// Contents
+		if ( ( view.row_ptr[ 0 ] != 0u ) || ( view.row_ptr[ n ] != nnz ) ) return error( "has invalid coupling offsets" );
+		for ( size_type i = 0; i < n; ++i ) {
+			Model_Variable const & var( view.vars[ i ] );
+			if ( view.row_ptr[ i ] > view.row_ptr[ i + 1u ] ) return error( "has invalid coupling offsets" );
+			if ( std::uint64_t( var.name_offset ) + var.name_length > view.names_bytes ) return error( "has an invalid variable name" );
+			if ( ( var.type > Model_Description::Input ) || ( var.method > n_methods ) ) return error( "has an invalid variable record" );
+			if ( ( var.type == Model_Description::Input ) && ( view.row_ptr[ i ] != view.row_ptr[ i + 1u ] ) ) return error( "has an input variable with couplings" );
+		}
+		for ( size_type k = 0; k < nnz; ++k ) {
+			if ( view.col[ k ] >= n ) return error( "has an invalid coupling column" );
+		}
+		return true;
+	}
+
+private: // Methods
+
+	// Report Error: Returns false
+	bool
+	error( std::string const & msg ) const
+	{
+		std::cerr << "Error: Binary model file " << file_name_ << ' ' << msg << std::endl;
+		return false;
+	}
+
+private: // Data
+
+	std::string file_name_; // Model file name
+	size_type size_{ 0u }; // File size
+	void * map_{ nullptr }; // Mapped file
+	std::vector< std::uint64_t > buffer_; // File contents where mapping is unavailable
+
+};
+
+// New State Variable of a QSS Method
+Variable_QSS< Function_LTI > *
+new_state( options::QSS const qss, std::string const & name, double const rTol, double const aTol, double const xIni )
+{
+	using options::QSS;
+	if ( qss == QSS::QSS1 ) {
+		return new Variable_QSS1< Function_LTI >( name, rTol, aTol, xIni );
+	} else if ( qss == QSS::QSS2 ) {
+		return new Variable_QSS2< Function_LTI >( name, rTol, aTol, xIni );
+	} else if ( qss == QSS::QSS3 ) {
+		return new Variable_QSS3< Function_LTI >( name, rTol, aTol, xIni );
+	} else if ( qss == QSS::LIQSS1 ) {
+		return new Variable_LIQSS1< Function_LTI >( name, rTol, aTol, xIni );
+	} else if ( qss == QSS::LIQSS2 ) {
+		return new Variable_LIQSS2< Function_LTI >( name, rTol, aTol, xIni );
+	} else {
+		throw std::runtime_error( "Unsupported QSS method for model file variable: " + name );
+	}
+}
+
+// New Input Variable of a QSS Method Order
+Variable_Inp< Function_sin > *
+new_input( options::QSS const qss, std::string const & name, double const rTol, double const aTol )
+{
+	using options::QSS;
+	if ( ( qss == QSS::QSS1 ) || ( qss == QSS::LIQSS1 ) ) {
+		return new Variable_Inp1< Function_sin >( name, rTol, aTol );
+	} else if ( ( qss == QSS::QSS2 ) || ( qss == QSS::LIQSS2 ) ) {
+		return new Variable_Inp2< Function_sin >( name, rTol, aTol );
+	} else {
+		return new Variable_Inp3< Function_sin >( name, rTol, aTol );
+	}
+}
+
+// Build Variables from a Model View
+void
+build( Model_View const & m, Variables & vars )
+{
+	size_type const n( m.n_vars );
+	std::vector< Variable_QSS< Function_LTI > * > states( n, nullptr );
+	vars.clear();
+	vars.reserve( n );
+
+	// Variables
+	for ( size_type i = 0; i < n; ++i ) {
+		Model_Variable const & var( m.vars[ i ] );
+		std::string const name( m.names + var.name_offset, var.name_length );
+		options::QSS const qss( var.method == 0u ? options::qss : options::QSS( var.method - 1u ) );
+		double const rTol( std::isnan( var.rTol ) ? options::rTol : var.rTol );
+		double const aTol( std::isnan( var.aTol ) ? options::aTol : var.aTol );
+		if ( var.type == Model_Description::Input ) {
+			Variable_Inp< Function_sin > * u( new_input( qss, name, rTol, aTol ) );
+			u->f().c( var.c ).s( var.s );
+			vars.push_back( u );
+		} else {
+			vars.push_back( states[ i ] = new_state( qss, name, rTol, aTol, var.xIni ) );
+		}
+		if ( var.dt_max > 0.0 ) vars.back()->set_dt_max( var.dt_max );
+	}
+
+	// Derivatives: Straight from the CSR rows
+	for ( size_type i = 0; i < n; ++i ) {
+		if ( states[ i ] == nullptr ) continue;
+		auto & d( states[ i ]->d() );
+		std::uint64_t const b( m.row_ptr[ i ] ), e( m.row_ptr[ i + 1u ] );
+		d.reserve( size_type( e - b ) );
+		if ( m.vars[ i ].c0 != 0.0 ) d.add( m.vars[ i ].c0 );
+		for ( std::uint64_t k = b; k < e; ++k ) {
+			d.add( m.val[ k ], vars[ m.col[ k ] ] );
+		}
+	}
+}
+
+} // Internal
+
+// Model File?
+bool
+is_model_file( std::string const & model )
+{
+	return has_suffix( model, ".qsm" ) || has_suffix( model, ".qsmb" );
+}
+
+// Read a Text Model File: Returns Whether Successful
+bool
+read_model_text( std::string const & file_name, Model_Description & model )
+{
+	return Text_Reader( file_name, model ).read();
+}
+
+// Write a Binary Model File: Returns Whether Successful
+bool
+write_model_binary( std::string const & file_name, Model_Description const & model )
+{
+	std::ofstream stream( file_name, std::ios_base::binary | std::ios_base::out | std::ios_base::trunc );
+	if ( ! stream ) {
+		std::cerr << "Error: Binary model file could not be opened: " << file_name << std::endl;
+		return false;
+	}
+	assert( model.row_ptr.size() == model.vars.size() + 1u );
+	assert( model.col.size() == model.val.size() );
+	Header header;
+	std::memcpy( header.magic, magic, sizeof( magic ) );
+	header.version = version;
+	header.n_vars = model.vars.size();
+	header.nnz = model.val.size();
+	header.names_bytes = model.names.size();
+	stream.write( reinterpret_cast< char const * >( &header ), sizeof( Header ) );
+	stream.write( reinterpret_cast< char const * >( model.vars.data() ), model.vars.size() * sizeof( Model_Variable ) );
+	stream.write( reinterpret_cast< char const * >( model.row_ptr.data() ), model.row_ptr.size() * sizeof( std::uint64_t ) );
+	stream.write( reinterpret_cast< char const * >( model.val.data() ), model.val.size() * sizeof( double ) );
+	stream.write( reinterpret_cast< char const * >( model.col.data() ), model.col.size() * sizeof( std::uint32_t ) );
+	stream.write( model.names.data(), model.names.size() );
+	if ( ! stream ) {
+		std::cerr << "Error: Binary model file write failed: " << file_name << std::endl;
+		return false;
+	}
+	return true;
+}
+
+// Load a Text or Binary Model File into Variables: Throws on Failure
+void
+load_model_file( std::string const & file_name, std::vector< Variable * > & vars )
+{
+	if ( has_suffix( file_name, ".qsmb" ) ) { // Binary: Built straight from the mapping
+		Mapped_Model mapped( file_name );
+		Model_View view;
+		if ( ! mapped.open( view ) ) throw std::runtime_error( "Model file could not be loaded: " + file_name );
+		build( view, vars );
+	} else { // Text
+		Model_Description model;
+		if ( ! read_model_text( file_name, model ) ) throw std::runtime_error( "Model file could not be loaded: " + file_name );
+		build( view_of( model ), vars );
+	}
+}
+
+// Convert a Text Model File to the Binary Form with .qsmb Extension: Returns Whether Successful
+bool
+model_text_to_binary( std::string const & file_name )
+{
+	Model_Description model;
+	if ( ! read_model_text( file_name, model ) ) return false;
+	return write_model_binary( file_name + 'b', model );
+}
@@ -0,0 +1,84 @@
+#ifndef QSS_Model_File_hh_INCLUDED
+#define QSS_Model_File_hh_INCLUDED
+
+// QSS Model Description Files
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// LTI models with sine inputs can be loaded from files instead of being compiled in
+// Text form (.qsm): One statement per line with # comments
+//  qss METHOD                      QSS method for variables declared after it without qss=  [--qss]
+//  var NAME [xIni=V] [rTol=V] [aTol=V] [dtMax=V] [qss=METHOD]   QSS state variable
+//  inp NAME sin [c=V] [s=V] [rTol=V] [aTol=V] [dtMax=V] [qss=METHOD]   Input variable u(t) = c sin( s t )
+//  der NAME TERM...                Derivative of a state variable: TERM is COEF*NAME, NAME, -NAME, or a constant
+//  Variables are numbered in declaration order and der terms may refer to variables declared later
+//  Unspecified tolerances use --rTol and --aTol when the model is built so both forms honor them
+// Binary form (.qsmb, native byte order) is laid out for memory-mapping with 8-byte aligned arrays:
+//  Header:    "QSSD" u32 version, u64 variables, u64 couplings (nonzeros), u64 name bytes
+//  Variables: Fixed-size records (see Model_Variable)
+//  Couplings: CSR derivative matrix: u64 row offsets[variables+1], f64 coefficients[nonzeros], u32 columns[nonzeros]
+//  Names:     Concatenated variable names
+// Both forms build the variables directly from the CSR arrays
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Forward
+class Variable;
+
+// Model Variable Record
+struct Model_Variable
+{
+	double xIni; // Initial value
+	double rTol; // Relative tolerance: NaN => --rTol
+	double aTol; // Absolute tolerance: NaN => --aTol
+	double dt_max; // Time step max: 0 => None
+	double c0; // Derivative constant term
+	double c; // Input value scaling
+	double s; // Input time scaling
+	std::uint32_t name_offset; // Name offset in names
+	std::uint16_t name_length; // Name length
+	std::uint8_t type; // State | Input
+	std::uint8_t method; // QSS method: 0 => Default, else 1 + options::QSS value
+};
+
+// Model Description: Variables and CSR Derivative Couplings
+struct Model_Description
+{
+	enum : std::uint8_t { State = 0u, Input = 1u }; // Variable types
+
+	std::vector< Model_Variable > vars; // Variables
+	std::vector< std::uint64_t > row_ptr; // CSR row offsets
+	std::vector< double > val; // CSR coefficients
+	std::vector< std::uint32_t > col; // CSR columns
+	std::string names; // Concatenated names
+};
+
+// Model File?
+bool
+is_model_file( std::string const & model );
+
+// Read a Text Model File: Returns Whether Successful
+bool
+read_model_text( std::string const & file_name, Model_Description & model );
+
+// Write a Binary Model File: Returns Whether Successful
+bool
+write_model_binary( std::string const & file_name, Model_Description const & model );
+
+// Load a Text or Binary Model File into Variables: Throws on Failure
+void
+load_model_file( std::string const & file_name, std::vector< Variable * > & vars );
+
+// Convert a Text Model File to the Binary Form with .qsmb Extension: Returns Whether Successful
+bool
+model_text_to_binary( std::string const & file_name );
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef QSS_Output_hh_INCLUDED
+#define QSS_Output_hh_INCLUDED
+
+// QSS Output Channels of One Kind
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Channels go to name.kind.out text files or to a shared results sink: Binary output file or in-memory buffers
+// A tap sink, such as a live output stream, can also receive every written record
+// With an asynchronous output queue attached the writes are done on the queue's writer thread
+// Requantization outputs can be decimated per channel by a min time interval and/or a min value change since the last output
+
+// QSS Headers
+#include <QSS/Memory.hh>
+#include <QSS/Output_Queue.hh>
+#include <QSS/Output_Sink.hh>
+
+// C++ Headers
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+// QSS Output Channels of One Kind
+class Output
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+	using Sink = Output_Sink;
+	using Queue = Output_Queue;
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Output(
+	 char const kind, // Output kind: x, q, f
+	 Sink * sink = nullptr, // Results sink: nullptr => Text files
+	 Sink * tap = nullptr // Additional sink receiving the same records
+	) :
+	 kind_( kind ),
+	 sink_( sink ),
+	 tap_( tap )
+	{}
+
+public: // Properties
+
+	// Number of Channels
+	size_type
+	size() const
+	{
+		return ( sink_ != nullptr ? channels_.size() : streams_.size() );
+	}
+
+	// Heap Bytes: Excluding the Sinks
+	size_type
+	heap_bytes() const
+	{
+		return Memory::heap( streams_ ) + ( streams_.size() * Memory::stream_buffer() ) + Memory::heap( channels_ ) + Memory::heap( taps_ ) + Memory::heap( tLast_ ) + Memory::heap( vLast_ );
+	}
+
+public: // Methods
+
+	// Set Requantization Output Decimation: Min Time Interval and Min Value Change
+	void
+	decimate( Time const dt, Value const dv )
+	{
+		dt_min_ = dt;
+		dv_min_ = dv;
+		decimate_ = ( dt_min_ > 0.0 ) || ( dv_min_ > 0.0 );
+	}
+
+	// Attach an Asynchronous Output Queue: After All Channels Added
+	void
+	queue( Queue * q )
+	{
+		queue_ = q;
+	}
+
+	// Add a Channel
+	void
+	add( std::string const & name )
+	{
+		if ( sink_ != nullptr ) {
+			channels_.push_back( sink_->add( name, kind_ ) );
+		} else {
+			streams_.push_back( std::ofstream( name + '.' + kind_ + ".out", std::ios_base::binary | std::ios_base::out ) );
+			streams_.back() << std::setprecision( 16 );
+		}
+		if ( tap_ != nullptr ) taps_.push_back( tap_->add( name, kind_ ) );
+		tLast_.push_back( 0.0 );
+		vLast_.push_back( 0.0 );
+	}
+
+	// Output a Value at Time t to Channel i
+	void
+	operator ()( size_type const i, Time const t, Value const v )
+	{
+		if ( decimate_ ) {
+			tLast_[ i ] = t;
+			vLast_[ i ] = v;
+		}
+		if ( queue_ != nullptr ) {
+			queue_->push( this, i, t, v );
+		} else {
+			write( i, t, v );
+		}
+	}
+
+	// Output a Requantization Event Value at Time t to Channel i: Can be Dropped by a Full Asynchronous Queue
+	void
+	requant( size_type const i, Time const t, Value const v )
+	{
+		if ( decimate_ ) { // Skip if too soon or too small a change since last output
+			assert( i < tLast_.size() );
+			if ( ( t - tLast_[ i ] < dt_min_ ) || ( std::abs( v - vLast_[ i ] ) < dv_min_ ) ) return;
+			tLast_[ i ] = t;
+			vLast_[ i ] = v;
+		}
+		if ( queue_ != nullptr ) {
+			queue_->push( this, i, t, v, true );
+		} else {
+			write( i, t, v );
+		}
+	}
+
+	// Write a Value at Time t to Channel i
+	void
+	write( size_type const i, Time const t, Value const v )
+	{
+		if ( sink_ != nullptr ) {
+			assert( i < channels_.size() );
+			sink_->put( channels_[ i ], t, v );
+		} else {
+			assert( i < streams_.size() );
+			streams_[ i ] << t << '\t' << v << '\n';
+		}
+		if ( tap_ != nullptr ) {
+			assert( i < taps_.size() );
+			tap_->put( taps_[ i ], t, v );
+		}
+	}
+
+	// Close Channel i
+	void
+	close( size_type const i )
+	{
+		if ( ( sink_ == nullptr ) && ( queue_ == nullptr ) ) {
+			assert( i < streams_.size() );
+			streams_[ i ].close();
+		} // Sink channels are closed with the sink and queued channels on destruction
+	}
+
+private: // Data
+
+	char kind_{ 'x' }; // Output kind: x, q, f
+	Sink * sink_{ nullptr }; // Results sink
+	Sink * tap_{ nullptr }; // Tap sink
+	Queue * queue_{ nullptr }; // Asynchronous output queue
+	std::vector< std::ofstream > streams_; // Text output streams
+	std::vector< size_type > channels_; // Sink channel indexes
+	std::vector< size_type > taps_; // Tap sink channel indexes
+	bool decimate_{ false }; // Decimate requantization outputs?
+	Time dt_min_{ 0.0 }; // Min time between requantization outputs
+	Value dv_min_{ 0.0 }; // Min value change between requantization outputs
+	std::vector< Time > tLast_; // Last output times
+	std::vector< Value > vLast_; // Last output values
+
+};
+
+#endif
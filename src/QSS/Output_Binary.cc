@@ -0,0 +1,252 @@
+// QSS Binary Columnar Output File
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Output_Binary.hh>
+#include <QSS/Output_Codec.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace { // Internal
+
+// File Magic Tag
+char const magic[ 4 ] = { 'Q', 'S', 'S', 'B' };
+
+// File Format Versions
+std::uint32_t const version( 1u ); // Raw blocks
+std::uint32_t const version_compressed( 2u ); // Compressed blocks
+
+// Write a Binary Value
+template< typename T >
+inline
+void
+write_bin( std::ostream & stream, T const & val )
+{
+	stream.write( reinterpret_cast< char const * >( &val ), sizeof( T ) );
+}
+
+// Read a Binary Value
+template< typename T >
+inline
+bool
+read_bin( std::istream & stream, T & val )
+{
+	return bool( stream.read( reinterpret_cast< char * >( &val ), sizeof( T ) ) );
+}
+
+} // Internal
+
+// Constructor
+Output_Binary_Writer::
+Output_Binary_Writer(
+ std::string const & file_name,
+ size_type const block_size,
+ bool const compress
+) :
+ stream_( file_name, std::ios_base::binary | std::ios_base::out ),
+ block_size_( std::max( block_size, size_type( 1u ) ) ),
+ compress_( compress )
+{
+	if ( ! stream_ ) {
+		std::cerr << "Error: Binary output file could not be opened: " << file_name << std::endl;
+		return;
+	}
+	stream_.write( magic, sizeof( magic ) );
+	write_bin( stream_, compress_ ? version_compressed : version );
+}
+
+// Add a Channel and Return its Index
+Output_Binary_Writer::size_type
+Output_Binary_Writer::
+add( std::string const & name, char const kind )
+{
+	channels_.push_back( Channel() );
+	Channel & channel( channels_.back() );
+	channel.name = name;
+	channel.kind = kind;
+	channel.t.reserve( block_size_ );
+	channel.v.reserve( block_size_ );
+	return channels_.size() - 1u;
+}
+
+// Flush Buffers, Write Index, and Close
+void
+Output_Binary_Writer::
+close()
+{
+	if ( ! stream_.is_open() ) return;
+	for ( size_type c = 0, e = channels_.size(); c < e; ++c ) {
+		flush( c );
+	}
+	Offset const index_offset( stream_.tellp() );
+	write_bin( stream_, std::uint32_t( channels_.size() ) );
+	for ( Channel const & channel : channels_ ) {
+		write_bin( stream_, std::uint8_t( channel.kind ) );
+		write_bin( stream_, std::uint32_t( channel.name.length() ) );
+		stream_.write( channel.name.data(), channel.name.length() );
+		write_bin( stream_, channel.n );
+		write_bin( stream_, std::uint32_t( channel.blocks.size() ) );
+		for ( Offset const block : channel.blocks ) {
+			write_bin( stream_, block );
+		}
+	}
+	write_bin( stream_, index_offset );
+	stream_.write( magic, sizeof( magic ) );
+	stream_.close();
+}
+
+// Flush a Channel's Buffered Records as a Block
+void
+Output_Binary_Writer::
+flush( size_type const c )
+{
+	Channel & channel( channels_[ c ] );
+	std::uint32_t const n( static_cast< std::uint32_t >( channel.t.size() ) );
+	if ( n == 0u ) return;
+	channel.blocks.push_back( stream_.tellp() );
+	write_bin( stream_, std::uint32_t( c ) );
+	write_bin( stream_, n );
+	if ( compress_ ) {
+		bytes_.clear();
+		encode_block( channel.t.data(), channel.v.data(), n, bytes_ );
+		write_bin( stream_, std::uint32_t( bytes_.size() ) );
+		stream_.write( reinterpret_cast< char const * >( bytes_.data() ), bytes_.size() );
+	} else {
+		stream_.write( reinterpret_cast< char const * >( channel.t.data() ), n * sizeof( Time ) );
+		stream_.write( reinterpret_cast< char const * >( channel.v.data() ), n * sizeof( Value ) );
+	}
+	channel.t.clear();
+	channel.v.clear();
+}
+
+// Constructor
+Output_Binary_Reader::
+Output_Binary_Reader( std::string const & file_name ) :
+ stream_( file_name, std::ios_base::binary | std::ios_base::in )
+{
+	if ( ! stream_ ) return;
+
+	// Preamble
+	char tag[ 4 ];
+	std::uint32_t file_version( 0u );
+	if ( ! ( stream_.read( tag, sizeof( tag ) ) && ( std::memcmp( tag, magic, sizeof( magic ) ) == 0 ) ) ) return;
+	if ( ! ( read_bin( stream_, file_version ) && ( ( file_version == version ) || ( file_version == version_compressed ) ) ) ) return;
+	compressed_ = ( file_version == version_compressed );
+
+	// Trailer
+	Offset index_offset( 0u );
+	if ( ! stream_.seekg( -std::streamoff( sizeof( Offset ) + sizeof( magic ) ), std::ios_base::end ) ) return; // No trailer: Run didn't close the file
+	if ( ! read_bin( stream_, index_offset ) ) return;
+	if ( ! ( stream_.read( tag, sizeof( tag ) ) && ( std::memcmp( tag, magic, sizeof( magic ) ) == 0 ) ) ) return;
+
+	// Index
+	if ( ! stream_.seekg( index_offset ) ) return;
+	std::uint32_t n_channels( 0u );
+	if ( ! read_bin( stream_, n_channels ) ) return;
+	channels_.resize( n_channels );
+	for ( Channel & channel : channels_ ) {
+		std::uint8_t kind( 0u );
+		std::uint32_t name_len( 0u );
+		std::uint32_t n_blocks( 0u );
+		if ( ! ( read_bin( stream_, kind ) && read_bin( stream_, name_len ) ) ) return;
+		channel.kind = char( kind );
+		channel.name.resize( name_len );
+		if ( ( name_len > 0u ) && ( ! stream_.read( &channel.name[ 0 ], name_len ) ) ) return;
+		if ( ! ( read_bin( stream_, channel.n ) && read_bin( stream_, n_blocks ) ) ) return;
+		channel.blocks.resize( n_blocks );
+		for ( Offset & block : channel.blocks ) {
+			if ( ! read_bin( stream_, block ) ) return;
+		}
+	}
+	good_ = true;
+}
+
+// Index of Channel with Given Name and Kind: size() if Not Found
+Output_Binary_Reader::size_type
+Output_Binary_Reader::
+find( std::string const & name, char const kind ) const
+{
+	for ( size_type c = 0, e = channels_.size(); c < e; ++c ) {
+		if ( ( channels_[ c ].kind == kind ) && ( channels_[ c ].name == name ) ) return c;
+	}
+	return channels_.size();
+}
+
+// Read a Channel's Records
+bool
+Output_Binary_Reader::
+read( size_type const c, Times & t, Values & v )
+{
+	assert( c < channels_.size() );
+	Channel const & channel( channels_[ c ] );
+	t.clear();
+	v.clear();
+	t.reserve( channel.n );
+	v.reserve( channel.n );
+	for ( Offset const block : channel.blocks ) {
+		std::uint32_t block_channel( 0u ), n( 0u );
+		stream_.clear();
+		if ( ! stream_.seekg( block ) ) return false;
+		if ( ! ( read_bin( stream_, block_channel ) && read_bin( stream_, n ) && ( block_channel == c ) ) ) return false;
+		if ( t.size() + n > channel.n ) return false;
+		size_type const b( t.size() );
+		t.resize( b + n );
+		v.resize( b + n );
+		if ( compressed_ ) {
+			std::uint32_t n_bytes( 0u );
+			if ( ! read_bin( stream_, n_bytes ) ) return false;
+			bytes_.resize( n_bytes );
+			if ( ( n_bytes > 0u ) && ( ! stream_.read( reinterpret_cast< char * >( bytes_.data() ), n_bytes ) ) ) return false;
+			if ( ! decode_block( bytes_.data(), bytes_.size(), n, t.data() + b, v.data() + b ) ) return false;
+		} else {
+			if ( ! stream_.read( reinterpret_cast< char * >( t.data() + b ), n * sizeof( Time ) ) ) return false;
+			if ( ! stream_.read( reinterpret_cast< char * >( v.data() + b ), n * sizeof( Value ) ) ) return false;
+		}
+	}
+	return t.size() == channel.n;
+}
+
+// Binary Output File Name for a Model: Model Base Name with .qss Extension
+std::string
+output_binary_name( std::string const & model )
+{
+	std::string::size_type const b( model.find_last_of( "/\\" ) );
+	std::string base( b == std::string::npos ? model : model.substr( b + 1u ) );
+	std::string::size_type const e( base.rfind( '.' ) );
+	if ( ( e != std::string::npos ) && ( e > 0u ) ) base.erase( e );
+	return base + ".qss";
+}
+
+// Convert a Binary Output File to name.kind.out Text Files: Returns Whether Successful
+bool
+output_binary_to_text( std::string const & file_name )
+{
+	Output_Binary_Reader reader( file_name );
+	if ( ! reader.good() ) {
+		std::cerr << "Error: Not a complete QSS binary output file: " << file_name << std::endl;
+		return false;
+	}
+	Output_Binary_Reader::Times t;
+	Output_Binary_Reader::Values v;
+	for ( Output_Binary_Reader::size_type c = 0, e = reader.size(); c < e; ++c ) {
+		if ( ! reader.read( c, t, v ) ) {
+			std::cerr << "Error: Corrupt records in QSS binary output file: " << file_name << std::endl;
+			return false;
+		}
+		std::ofstream stream( reader.name( c ) + '.' + reader.kind( c ) + ".out", std::ios_base::binary | std::ios_base::out );
+		stream << std::setprecision( 16 );
+		for ( Output_Binary_Reader::size_type i = 0, n = t.size(); i < n; ++i ) {
+			stream << t[ i ] << '\t' << v[ i ] << '\n';
+		}
+	}
+	return true;
+}
@@ -0,0 +1,248 @@
+#ifndef QSS_Output_Binary_hh_INCLUDED
+#define QSS_Output_Binary_hh_INCLUDED
+
+// QSS Binary Columnar Output File
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// All output channels (variable + output kind) go to one file instead of one text file per channel
+// Layout (native byte order):
+//  Preamble: "QSSB" u32 version
+//  Blocks:   u32 channel, u32 n, f64 t[n], f64 v[n]  (Columnar time and value runs of one channel)
+//            Version 2 (compressed): u32 channel, u32 n, u32 bytes, encoded block (see Output_Codec.hh)
+//  Index:    u32 channels, then per channel: u8 kind, u32 name length, name, u64 records, u32 blocks, u64 block offsets
+//  Trailer:  u64 index offset, "QSSB"
+// The index is written at close so a file from a crashed run has no index
+
+// QSS Headers
+#include <QSS/Memory.hh>
+#include <QSS/Output_Sink.hh>
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// QSS Binary Output File Writer
+class Output_Binary_Writer final : public Output_Sink
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+	using Offset = std::uint64_t;
+
+private: // Types
+
+	struct Channel
+	{
+		std::string name; // Variable name
+		char kind{ 'x' }; // Output kind: x, q, f
+		std::vector< Time > t; // Block time buffer
+		std::vector< Value > v; // Block value buffer
+		std::uint64_t n{ 0u }; // Records
+		std::vector< Offset > blocks; // Block file offsets
+	};
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Output_Binary_Writer(
+	 std::string const & file_name,
+	 size_type const block_size = 256u, // Records per block
+	 bool const compress = false // Compressed blocks?
+	);
+
+	// Copy Constructor
+	Output_Binary_Writer( Output_Binary_Writer const & ) = delete;
+
+	// Destructor
+	~Output_Binary_Writer()
+	{
+		close();
+	}
+
+public: // Assignment
+
+	// Copy Assignment
+	Output_Binary_Writer &
+	operator =( Output_Binary_Writer const & ) = delete;
+
+public: // Properties
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return stream_.is_open();
+	}
+
+	// Number of Channels
+	size_type
+	size() const
+	{
+		return channels_.size();
+	}
+
+	// Heap Bytes
+	size_type
+	heap_bytes() const
+	{
+		size_type n( Memory::heap( channels_ ) + Memory::heap( bytes_ ) + ( stream_.is_open() ? Memory::stream_buffer() : 0u ) );
+		for ( Channel const & channel : channels_ ) n += Memory::heap( channel.name ) + Memory::heap( channel.t ) + Memory::heap( channel.v ) + Memory::heap( channel.blocks );
+		return n;
+	}
+
+public: // Methods
+
+	// Add a Channel and Return its Index
+	size_type
+	add( std::string const & name, char const kind );
+
+	// Put a Record
+	void
+	put( size_type const c, Time const t, Value const v )
+	{
+		assert( c < channels_.size() );
+		Channel & channel( channels_[ c ] );
+		channel.t.push_back( t );
+		channel.v.push_back( v );
+		++channel.n;
+		if ( channel.t.size() >= block_size_ ) flush( c );
+	}
+
+	// Flush Buffers, Write Index, and Close
+	void
+	close();
+
+private: // Methods
+
+	// Flush a Channel's Buffered Records as a Block
+	void
+	flush( size_type const c );
+
+private: // Data
+
+	std::ofstream stream_; // Output file stream
+	size_type block_size_{ 256u }; // Records per block
+	bool compress_{ false }; // Compressed blocks?
+	std::vector< Channel > channels_; // Channels
+	std::vector< std::uint8_t > bytes_; // Compressed block buffer
+
+};
+
+// QSS Binary Output File Reader
+class Output_Binary_Reader
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+	using Offset = std::uint64_t;
+	using Times = std::vector< Time >;
+	using Values = std::vector< Value >;
+
+private: // Types
+
+	struct Channel
+	{
+		std::string name; // Variable name
+		char kind{ 'x' }; // Output kind: x, q, f
+		std::uint64_t n{ 0u }; // Records
+		std::vector< Offset > blocks; // Block file offsets
+	};
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Output_Binary_Reader( std::string const & file_name );
+
+public: // Properties
+
+	// Valid File?
+	bool
+	good() const
+	{
+		return good_;
+	}
+
+	// Compressed Blocks?
+	bool
+	compressed() const
+	{
+		return compressed_;
+	}
+
+	// Number of Channels
+	size_type
+	size() const
+	{
+		return channels_.size();
+	}
+
+	// Channel Name
+	std::string const &
+	name( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].name;
+	}
+
+	// Channel Output Kind
+	char
+	kind( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].kind;
+	}
+
+	// Channel Number of Records
+	std::uint64_t
+	n_records( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].n;
+	}
+
+	// Index of Channel with Given Name and Kind: size() if Not Found
+	size_type
+	find( std::string const & name, char const kind ) const;
+
+public: // Methods
+
+	// Read a Channel's Records
+	bool
+	read( size_type const c, Times & t, Values & v );
+
+private: // Data
+
+	std::ifstream stream_; // Input file stream
+	bool good_{ false }; // Valid file?
+	bool compressed_{ false }; // Compressed blocks?
+	std::vector< Channel > channels_; // Channels
+	std::vector< std::uint8_t > bytes_; // Compressed block buffer
+
+};
+
+// Binary Output File Name for a Model: Model Base Name with .qss Extension
+std::string
+output_binary_name( std::string const & model );
+
+// Convert a Binary Output File to name.kind.out Text Files: Returns Whether Successful
+bool
+output_binary_to_text( std::string const & file_name );
+
+#endif
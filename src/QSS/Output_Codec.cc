@@ -0,0 +1,348 @@
+// QSS Output Block Compression
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Output_Codec.hh>
+
+// C++ Headers
+#include <cstring>
+
+namespace { // Internal
+
+// Bits of a double
+inline
+std::uint64_t
+bits_of( double const d )
+{
+	std::uint64_t u;
+	std::memcpy( &u, &d, sizeof( u ) );
+	return u;
+}
+
+// double of Bits
+inline
+double
+double_of( std::uint64_t const u )
+{
+	double d;
+	std::memcpy( &d, &u, sizeof( d ) );
+	return d;
+}
+
+// Leading Zero Bits of Nonzero Value
+inline
+int
+leading_zeros( std::uint64_t u )
+{
+#ifdef __GNUC__
+	return __builtin_clzll( u );
+#else
+	int n( 0 );
+	while ( ( u & ( std::uint64_t( 1u ) << 63 ) ) == 0u ) {
+		u <<= 1;
+		++n;
+	}
+	return n;
+#endif
+}
+
+// Trailing Zero Bits of Nonzero Value
+inline
+int
+trailing_zeros( std::uint64_t u )
+{
+#ifdef __GNUC__
+	return __builtin_ctzll( u );
+#else
+	int n( 0 );
+	while ( ( u & 1u ) == 0u ) {
+		u >>= 1;
+		++n;
+	}
+	return n;
+#endif
+}
+
+// Low n Bits Mask: 0 <= n <= 64
+inline
+std::uint64_t
+mask( int const n )
+{
+	return ( n >= 64 ? ~std::uint64_t( 0u ) : ( std::uint64_t( 1u ) << n ) - 1u );
+}
+
+// Bit Stream Writer: Most Significant Bit First
+class Bit_Writer
+{
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Bit_Writer( std::vector< std::uint8_t > & bytes ) :
+	 bytes_( bytes )
+	{}
+
+public: // Methods
+
+	// Write Low n Bits of u: 1 <= n <= 64
+	void
+	write( std::uint64_t u, int n )
+	{
+		if ( n > 32 ) {
+			write( u >> 32, n - 32 );
+			n = 32;
+		}
+		acc_ = ( acc_ << n ) | ( u & mask( n ) );
+		bits_ += n;
+		while ( bits_ >= 8 ) {
+			bits_ -= 8;
+			bytes_.push_back( std::uint8_t( acc_ >> bits_ ) );
+		}
+	}
+
+	// Flush Partial Byte
+	void
+	flush()
+	{
+		if ( bits_ > 0 ) bytes_.push_back( std::uint8_t( acc_ << ( 8 - bits_ ) ) );
+		bits_ = 0;
+	}
+
+private: // Data
+
+	std::vector< std::uint8_t > & bytes_; // Output bytes
+	std::uint64_t acc_{ 0u }; // Bit accumulator
+	int bits_{ 0 }; // Unwritten bits in accumulator
+
+};
+
+// Bit Stream Reader: Most Significant Bit First
+class Bit_Reader
+{
+
+public: // Creation
+
+	// Constructor
+	Bit_Reader( std::uint8_t const * bytes, std::size_t const n_bytes ) :
+	 bytes_( bytes ),
+	 n_bytes_( n_bytes )
+	{}
+
+public: // Properties
+
+	// Read Past End?
+	bool
+	overrun() const
+	{
+		return overrun_;
+	}
+
+public: // Methods
+
+	// Read n Bits: 1 <= n <= 64
+	std::uint64_t
+	read( int n )
+	{
+		if ( n > 32 ) {
+			std::uint64_t const hi( read( n - 32 ) );
+			return ( hi << 32 ) | read( 32 );
+		}
+		std::uint64_t u( 0u );
+		while ( n > 0 ) {
+			if ( i_ >= n_bytes_ ) {
+				overrun_ = true;
+				return 0u;
+			}
+			int const avail( 8 - bit_ );
+			int const take( n < avail ? n : avail );
+			u = ( u << take ) | ( ( bytes_[ i_ ] >> ( avail - take ) ) & mask( take ) );
+			bit_ += take;
+			n -= take;
+			if ( bit_ == 8 ) {
+				bit_ = 0;
+				++i_;
+			}
+		}
+		return u;
+	}
+
+	// Read a Bit
+	bool
+	bit()
+	{
+		return read( 1 ) != 0u;
+	}
+
+private: // Data
+
+	std::uint8_t const * bytes_; // Input bytes
+	std::size_t n_bytes_; // Input bytes size
+	std::size_t i_{ 0u }; // Current byte
+	int bit_{ 0 }; // Bits of current byte consumed
+	bool overrun_{ false }; // Read past end?
+
+};
+
+// Sign-Extend Low n Bits
+inline
+std::int64_t
+sign_extended( std::uint64_t const u, int const n )
+{
+	std::uint64_t const sign( std::uint64_t( 1u ) << ( n - 1 ) );
+	return static_cast< std::int64_t >( ( u ^ sign ) - sign );
+}
+
+// Fits in n-Bit Two's Complement?
+inline
+bool
+fits( std::int64_t const d, int const n )
+{
+	std::int64_t const lim( std::int64_t( 1 ) << ( n - 1 ) );
+	return ( -lim <= d ) && ( d < lim );
+}
+
+} // Internal
+
+// Encode a Block of Records: Appends to Bytes
+void
+encode_block(
+ double const * t,
+ double const * v,
+ std::size_t const n,
+ std::vector< std::uint8_t > & bytes
+)
+{
+	if ( n == 0u ) return;
+	Bit_Writer w( bytes );
+
+	// Times
+	std::uint64_t t_prev( bits_of( t[ 0 ] ) );
+	std::uint64_t delta_prev( 0u );
+	w.write( t_prev, 64 );
+	for ( std::size_t i = 1; i < n; ++i ) {
+		std::uint64_t const t_bits( bits_of( t[ i ] ) );
+		std::uint64_t const delta( t_bits - t_prev ); // Modular arithmetic: Exact round trip for any bit patterns
+		std::int64_t const dod( static_cast< std::int64_t >( delta - delta_prev ) );
+		if ( dod == 0 ) {
+			w.write( 0u, 1 );
+		} else if ( fits( dod, 7 ) ) {
+			w.write( 0x2u, 2 );
+			w.write( std::uint64_t( dod ), 7 );
+		} else if ( fits( dod, 9 ) ) {
+			w.write( 0x6u, 3 );
+			w.write( std::uint64_t( dod ), 9 );
+		} else if ( fits( dod, 12 ) ) {
+			w.write( 0xEu, 4 );
+			w.write( std::uint64_t( dod ), 12 );
+		} else if ( fits( dod, 32 ) ) {
+			w.write( 0x1Eu, 5 );
+			w.write( std::uint64_t( dod ), 32 );
+		} else {
+			w.write( 0x1Fu, 5 );
+			w.write( std::uint64_t( dod ), 64 );
+		}
+		t_prev = t_bits;
+		delta_prev = delta;
+	}
+
+	// Values
+	std::uint64_t v_prev( bits_of( v[ 0 ] ) );
+	int lz_prev( 65 ), tz_prev( 65 ); // No window yet
+	w.write( v_prev, 64 );
+	for ( std::size_t i = 1; i < n; ++i ) {
+		std::uint64_t const v_bits( bits_of( v[ i ] ) );
+		std::uint64_t const x( v_bits ^ v_prev );
+		if ( x == 0u ) {
+			w.write( 0u, 1 );
+		} else {
+			int lz( leading_zeros( x ) );
+			int const tz( trailing_zeros( x ) );
+			if ( lz > 31 ) lz = 31; // 5 bit field
+			if ( ( lz >= lz_prev ) && ( tz >= tz_prev ) ) { // Fits previous window
+				w.write( 0x2u, 2 );
+				w.write( x >> tz_prev, 64 - lz_prev - tz_prev );
+			} else {
+				int const sig( 64 - lz - tz );
+				w.write( 0x3u, 2 );
+				w.write( std::uint64_t( lz ), 5 );
+				w.write( std::uint64_t( sig & 63 ), 6 ); // 64 => 0
+				w.write( x >> tz, sig );
+				lz_prev = lz;
+				tz_prev = tz;
+			}
+		}
+		v_prev = v_bits;
+	}
+	w.flush();
+}
+
+// Decode a Block of n Records: Returns Whether the Bytes Held n Valid Records
+bool
+decode_block(
+ std::uint8_t const * bytes,
+ std::size_t const n_bytes,
+ std::size_t const n,
+ double * t,
+ double * v
+)
+{
+	if ( n == 0u ) return true;
+	Bit_Reader r( bytes, n_bytes );
+
+	// Times
+	std::uint64_t t_prev( r.read( 64 ) );
+	std::uint64_t delta_prev( 0u );
+	t[ 0 ] = double_of( t_prev );
+	for ( std::size_t i = 1; i < n; ++i ) {
+		std::int64_t dod( 0 );
+		if ( r.bit() ) {
+			if ( ! r.bit() ) {
+				dod = sign_extended( r.read( 7 ), 7 );
+			} else if ( ! r.bit() ) {
+				dod = sign_extended( r.read( 9 ), 9 );
+			} else if ( ! r.bit() ) {
+				dod = sign_extended( r.read( 12 ), 12 );
+			} else if ( ! r.bit() ) {
+				dod = sign_extended( r.read( 32 ), 32 );
+			} else {
+				dod = static_cast< std::int64_t >( r.read( 64 ) );
+			}
+		}
+		std::uint64_t const delta( delta_prev + std::uint64_t( dod ) );
+		t_prev += delta;
+		delta_prev = delta;
+		t[ i ] = double_of( t_prev );
+	}
+
+	// Values
+	std::uint64_t v_prev( r.read( 64 ) );
+	int lz_prev( 0 ), tz_prev( 0 );
+	bool window( false );
+	v[ 0 ] = double_of( v_prev );
+	for ( std::size_t i = 1; i < n; ++i ) {
+		if ( r.bit() ) {
+			if ( ! r.bit() ) { // Previous window
+				if ( ! window ) return false;
+				v_prev ^= r.read( 64 - lz_prev - tz_prev ) << tz_prev;
+			} else {
+				int const lz( static_cast< int >( r.read( 5 ) ) );
+				int sig( static_cast< int >( r.read( 6 ) ) );
+				if ( sig == 0 ) sig = 64;
+				if ( lz + sig > 64 ) return false;
+				int const tz( 64 - lz - sig );
+				v_prev ^= r.read( sig ) << tz;
+				lz_prev = lz;
+				tz_prev = tz;
+				window = true;
+			}
+		}
+		v[ i ] = double_of( v_prev );
+	}
+	return ! r.overrun();
+}
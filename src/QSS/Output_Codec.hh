@@ -0,0 +1,42 @@
+#ifndef QSS_Output_Codec_hh_INCLUDED
+#define QSS_Output_Codec_hh_INCLUDED
+
+// QSS Output Block Compression
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Lossless bit-packed encoding of a block of (time, value) records of one channel
+// Times: First raw, then delta-of-delta of the IEEE bit patterns (monotone times have monotone patterns) in prefix-coded buckets
+//  0 => 0 | 10 => 7 bits | 110 => 9 bits | 1110 => 12 bits | 11110 => 32 bits | 11111 => 64 bits
+// Values: First raw, then Gorilla-style XOR with the previous value
+//  0 => Same | 10 => Meaningful bits in previous window | 11 => 5 bits leading zeros, 6 bits length (64 as 0), meaningful bits
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Encode a Block of Records: Appends to Bytes
+void
+encode_block(
+ double const * t,
+ double const * v,
+ std::size_t const n,
+ std::vector< std::uint8_t > & bytes
+);
+
+// Decode a Block of n Records: Returns Whether the Bytes Held n Valid Records
+bool
+decode_block(
+ std::uint8_t const * bytes,
+ std::size_t const n_bytes,
+ std::size_t const n,
+ double * t,
+ double * v
+);
+
+#endif
@@ -0,0 +1,118 @@
+// QSS Output Variable Selection Filter
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Output_Filter.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+// Variable Selected?
+bool
+Output_Filter::
+selected( std::string const & name, std::string const & causality ) const
+{
+	if ( ( ! causality.empty() ) && ( ! causalities_.empty() ) ) { // FMU variable causality filter
+		if ( std::find( causalities_.begin(), causalities_.end(), causality ) == causalities_.end() ) return false;
+	}
+	if ( globs_.empty() && regexes_.empty() ) return true;
+	for ( std::string const & glob : globs_ ) {
+		if ( glob_match( glob.c_str(), name.c_str() ) ) return true;
+	}
+	for ( std::regex const & regex : regexes_ ) {
+		if ( std::regex_match( name, regex ) ) return true;
+	}
+	return false;
+}
+
+// Add a Name Pattern: Returns Whether Valid
+bool
+Output_Filter::
+add_pattern( std::string const & pattern )
+{
+	if ( pattern.compare( 0u, 3u, "re:" ) == 0 ) { // Regular expression
+		try {
+			regexes_.emplace_back( pattern.substr( 3u ), std::regex::ECMAScript | std::regex::optimize );
+		} catch ( std::regex_error const & ) {
+			std::cerr << "Error: Invalid output variable regular expression: " << pattern.substr( 3u ) << std::endl;
+			return false;
+		}
+	} else { // Glob
+		globs_.push_back( pattern );
+	}
+	return true;
+}
+
+// Add Name Patterns from a List File with One Pattern per Line: Blank and # Lines Skipped: Returns Whether Successful
+bool
+Output_Filter::
+add_file( std::string const & file_name )
+{
+	std::ifstream stream( file_name );
+	if ( ! stream ) {
+		std::cerr << "Error: Output variable list file could not be opened: " << file_name << std::endl;
+		return false;
+	}
+	bool valid( true );
+	std::string line;
+	while ( std::getline( stream, line ) ) {
+		std::string::size_type const b( line.find_first_not_of( " \t\r" ) );
+		if ( ( b == std::string::npos ) || ( line[ b ] == '#' ) ) continue;
+		std::string::size_type const e( line.find_last_not_of( " \t\r" ) );
+		if ( ! add_pattern( line.substr( b, e - b + 1u ) ) ) valid = false;
+	}
+	return valid;
+}
+
+// Glob Match with * and ? Wildcards
+bool
+Output_Filter::
+glob_match( char const * pattern, char const * name )
+{
+	char const * star( nullptr ); // Position after last * in pattern
+	char const * mark( nullptr ); // Name position matched by last *
+	while ( *name != '\0' ) {
+		if ( ( *pattern == '?' ) || ( ( *pattern == *name ) && ( *pattern != '*' ) ) ) {
+			++pattern;
+			++name;
+		} else if ( *pattern == '*' ) {
+			star = ++pattern;
+			mark = name;
+		} else if ( star != nullptr ) { // Backtrack: Let last * consume one more char
+			pattern = star;
+			name = ++mark;
+		} else {
+			return false;
+		}
+	}
+	while ( *pattern == '*' ) ++pattern;
+	return ( *pattern == '\0' );
+}
+
+// Output Filter from Options: Throws on Invalid Patterns
+Output_Filter
+output_filter()
+{
+	Output_Filter filter;
+	bool valid( true );
+	for ( std::string const & pattern : options::var ) {
+		if ( ! filter.add_pattern( pattern ) ) valid = false;
+	}
+	if ( ! options::var_file.empty() ) {
+		if ( ! filter.add_file( options::var_file ) ) valid = false;
+	}
+	for ( std::string const & causality : options::causality ) {
+		filter.add_causality( causality );
+	}
+	if ( ! valid ) throw std::runtime_error( "Invalid output variable selection" );
+	return filter;
+}
@@ -0,0 +1,83 @@
+#ifndef QSS_Output_Filter_hh_INCLUDED
+#define QSS_Output_Filter_hh_INCLUDED
+
+// QSS Output Variable Selection Filter
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Name patterns are globs with * and ? wildcards or, with an re: prefix, ECMAScript regular expressions matching the whole name
+// A variable is selected if it matches any pattern (or no patterns are given) and, for FMU variables, has one of the causalities (if any are given)
+// Selection is done once at setup: Unselected variables get no output channel and cost nothing in the event loop
+
+// C++ Headers
+#include <regex>
+#include <string>
+#include <vector>
+
+// QSS Output Variable Selection Filter
+class Output_Filter
+{
+
+public: // Creation
+
+	// Default Constructor: Selects All Variables
+	Output_Filter()
+	{}
+
+public: // Properties
+
+	// Selects All Variables?
+	bool
+	all() const
+	{
+		return globs_.empty() && regexes_.empty() && causalities_.empty();
+	}
+
+	// Variable Selected?
+	bool
+	selected(
+	 std::string const & name,
+	 std::string const & causality = std::string() // FMU variable causality: Empty => Not an FMU variable
+	) const;
+
+public: // Methods
+
+	// Add a Name Pattern: Returns Whether Valid
+	bool
+	add_pattern( std::string const & pattern );
+
+	// Add Name Patterns from a List File with One Pattern per Line: Blank and # Lines Skipped: Returns Whether Successful
+	bool
+	add_file( std::string const & file_name );
+
+	// Add an FMU Causality
+	void
+	add_causality( std::string const & causality )
+	{
+		causalities_.push_back( causality );
+	}
+
+public: // Static Methods
+
+	// Glob Match with * and ? Wildcards
+	static
+	bool
+	glob_match( char const * pattern, char const * name );
+
+private: // Data
+
+	std::vector< std::string > globs_; // Glob patterns
+	std::vector< std::regex > regexes_; // Regular expression patterns
+	std::vector< std::string > causalities_; // FMU causalities
+
+};
+
+// Output Filter from Options: Throws on Invalid Patterns
+Output_Filter
+output_filter();
+
+#endif
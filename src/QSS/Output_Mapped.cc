@@ -0,0 +1,261 @@
+// QSS Memory-Mapped Output File
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Output_Mapped.hh>
+#include <QSS/Output_Binary.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+// POSIX Headers
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace { // Internal
+
+// File Magic Tag
+char const magic[ 4 ] = { 'Q', 'S', 'S', 'M' };
+
+// Chunk States
+char const state_open[ 4 ] = { 'O', 'P', 'E', 'N' };
+char const state_done[ 4 ] = { 'D', 'O', 'N', 'E' };
+char const state_last[ 4 ] = { 'L', 'A', 'S', 'T' };
+
+// File Format Version
+std::uint32_t const version( 1u );
+
+// Name Bytes per Record
+std::size_t const name_bytes( 2u * sizeof( double ) );
+
+using Header = Output_Mapped_Writer::Header;
+using Record = Output_Mapped_Writer::Record;
+
+static_assert( sizeof( Header ) == 32u, "Unexpected chunk header size" );
+static_assert( sizeof( Record ) == 24u, "Unexpected record size" );
+static_assert( offsetof( Record, v ) == offsetof( Record, t ) + sizeof( double ), "Record name bytes must be contiguous" );
+
+} // Internal
+
+// Constructor
+Output_Mapped_Writer::
+Output_Mapped_Writer(
+ std::string const & file_name,
+ size_type const chunk_bytes
+)
+{
+#ifndef _WIN32
+	size_type const page( static_cast< size_type >( ::sysconf( _SC_PAGESIZE ) ) );
+	chunk_bytes_ = std::max( ( ( chunk_bytes + page - 1u ) / page ) * page, page ); // Page multiple so chunk offsets are mappable
+	capacity_ = ( chunk_bytes_ - sizeof( Header ) ) / sizeof( Record );
+	n_ = capacity_; // First put or add maps the first chunk
+	fd_ = ::open( file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+	if ( fd_ < 0 ) {
+		std::cerr << "Error: Memory-mapped output file could not be opened: " << file_name << std::endl;
+		return;
+	}
+	chunk_offset_ = 0u;
+	next_chunk();
+#else
+	(void)chunk_bytes;
+	std::cerr << "Error: Memory-mapped output files are not supported on this platform: " << file_name << std::endl;
+#endif
+}
+
+// Add a Channel and Return its Index
+Output_Mapped_Writer::size_type
+Output_Mapped_Writer::
+add( std::string const & name, char const kind )
+{
+	size_type const c( n_channels_++ );
+	std::string::size_type pos( 0u );
+	do { // Name records: At least one even for an empty name
+		if ( n_ == capacity_ ) next_chunk();
+		if ( records_ == nullptr ) break;
+		Record & record( records_[ n_++ ] );
+		std::string::size_type const len( std::min( name.length() - pos, name_bytes ) );
+		record.c = std::uint32_t( c );
+		record.type = ( pos == 0u ? Name : Name_More );
+		record.kind = std::uint8_t( kind );
+		record.len = std::uint16_t( len );
+		char bytes[ name_bytes ] = {};
+		name.copy( bytes, len, pos );
+		std::memcpy( &record.t, bytes, name_bytes );
+		pos += len;
+	} while ( pos < name.length() );
+	return c;
+}
+
+// Complete Chunk, Truncate, and Close
+void
+Output_Mapped_Writer::
+close()
+{
+#ifndef _WIN32
+	if ( fd_ < 0 ) return;
+	std::uint64_t const end( chunk_offset_ + sizeof( Header ) + n_ * sizeof( Record ) );
+	complete_chunk( state_last );
+	if ( ::ftruncate( fd_, static_cast< off_t >( end ) ) != 0 ) {
+		std::cerr << "Error: Memory-mapped output file truncation failed" << std::endl;
+	}
+	::close( fd_ );
+	fd_ = -1;
+#endif
+}
+
+// Complete Current Chunk and Map the Next One
+void
+Output_Mapped_Writer::
+next_chunk()
+{
+#ifndef _WIN32
+	if ( fd_ < 0 ) {
+		n_ = 0u; // Writes are dropped
+		return;
+	}
+	if ( header_ != nullptr ) {
+		complete_chunk( state_done );
+		chunk_offset_ += chunk_bytes_;
+	}
+	if ( ::ftruncate( fd_, static_cast< off_t >( chunk_offset_ + chunk_bytes_ ) ) != 0 ) { // Grow file by a chunk
+		std::cerr << "Error: Memory-mapped output file could not be grown" << std::endl;
+		n_ = 0u;
+		return;
+	}
+	void * map( ::mmap( nullptr, chunk_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, static_cast< off_t >( chunk_offset_ ) ) );
+	if ( map == MAP_FAILED ) {
+		std::cerr << "Error: Memory-mapped output file chunk could not be mapped" << std::endl;
+		n_ = 0u;
+		return;
+	}
+	header_ = static_cast< Header * >( map );
+	records_ = reinterpret_cast< Record * >( static_cast< char * >( map ) + sizeof( Header ) );
+	std::memcpy( header_->magic, magic, sizeof( magic ) );
+	header_->version = version;
+	header_->capacity = capacity_;
+	header_->n = 0u;
+	std::memcpy( header_->state, state_open, sizeof( state_open ) );
+	header_->reserved = 0u;
+	n_ = 0u;
+#endif
+}
+
+// Complete and Unmap Current Chunk
+void
+Output_Mapped_Writer::
+complete_chunk( char const * state )
+{
+#ifndef _WIN32
+	if ( header_ == nullptr ) return;
+	header_->n = n_; // Count before state marker
+	std::memcpy( header_->state, state, sizeof( state_done ) );
+	::msync( header_, chunk_bytes_, MS_ASYNC ); // Start write-back: Page cache already makes the chunk visible to readers
+	::munmap( header_, chunk_bytes_ );
+	header_ = nullptr;
+	records_ = nullptr;
+#else
+	(void)state;
+#endif
+}
+
+// Constructor
+Output_Mapped_Reader::
+Output_Mapped_Reader( std::string const & file_name )
+{
+	std::ifstream stream( file_name, std::ios_base::binary | std::ios_base::in );
+	if ( ! stream ) return;
+	stream.seekg( 0, std::ios_base::end );
+	std::uint64_t const file_size( stream.tellg() );
+	std::uint64_t offset( 0u );
+	std::vector< Record > records;
+	while ( offset + sizeof( Header ) <= file_size ) {
+		Header header;
+		if ( ! ( stream.seekg( offset ) && stream.read( reinterpret_cast< char * >( &header ), sizeof( Header ) ) ) ) break;
+		if ( std::memcmp( header.magic, magic, sizeof( magic ) ) != 0 ) break;
+		if ( header.version != version ) break;
+		bool const done( std::memcmp( header.state, state_done, sizeof( state_done ) ) == 0 );
+		bool const last( std::memcmp( header.state, state_last, sizeof( state_last ) ) == 0 );
+		if ( ! ( done || last ) ) break; // Incomplete chunk from a killed run
+		if ( header.n > header.capacity ) break;
+		records.resize( header.n );
+		if ( ( header.n > 0u ) && ( ! stream.read( reinterpret_cast< char * >( records.data() ), header.n * sizeof( Record ) ) ) ) break;
+		for ( Record const & record : records ) {
+			if ( record.type == Output_Mapped_Writer::Data ) {
+				if ( record.c >= channels_.size() ) return; // Corrupt
+				Channel & channel( channels_[ record.c ] );
+				channel.t.push_back( record.t );
+				channel.v.push_back( record.v );
+			} else {
+				if ( ( record.len > name_bytes ) || ( record.c > channels_.size() ) ) return; // Corrupt
+				if ( record.type == Output_Mapped_Writer::Name ) {
+					if ( record.c != channels_.size() ) return; // Corrupt: Channels are added in order
+					channels_.push_back( Channel() );
+					channels_.back().kind = char( record.kind );
+				} else if ( record.c + 1u != channels_.size() ) {
+					return; // Corrupt: Continuation of a channel other than the last added
+				}
+				channels_[ record.c ].name.append( reinterpret_cast< char const * >( &record.t ), record.len );
+			}
+		}
+		good_ = true;
+		if ( last ) {
+			complete_ = true;
+			break;
+		}
+		offset += sizeof( Header ) + header.capacity * sizeof( Record );
+		offset = ( ( offset + 4095u ) / 4096u ) * 4096u; // Tail padding to page multiple: Page size is a power of 2 >= 4096
+	}
+}
+
+// Index of Channel with Given Name and Kind: size() if Not Found
+Output_Mapped_Reader::size_type
+Output_Mapped_Reader::
+find( std::string const & name, char const kind ) const
+{
+	for ( size_type c = 0, e = channels_.size(); c < e; ++c ) {
+		if ( ( channels_[ c ].kind == kind ) && ( channels_[ c ].name == name ) ) return c;
+	}
+	return channels_.size();
+}
+
+// Memory-Mapped Output File Name for a Model: Model Base Name with .qssm Extension
+std::string
+output_mapped_name( std::string const & model )
+{
+	return output_binary_name( model ) + 'm'; // Model base name with .qss extension + m
+}
+
+// Convert a Memory-Mapped Output File to name.kind.out Text Files: Returns Whether Successful
+bool
+output_mapped_to_text( std::string const & file_name )
+{
+	Output_Mapped_Reader reader( file_name );
+	if ( ! reader.good() ) {
+		std::cerr << "Error: Not a QSS memory-mapped output file or no complete chunks: " << file_name << std::endl;
+		return false;
+	}
+	if ( ! reader.complete() ) std::cerr << "Warning: Memory-mapped output file was not closed: Converting records up to the last complete chunk" << std::endl;
+	for ( Output_Mapped_Reader::size_type c = 0, e = reader.size(); c < e; ++c ) {
+		Output_Mapped_Reader::Times const & t( reader.t( c ) );
+		Output_Mapped_Reader::Values const & v( reader.v( c ) );
+		std::ofstream stream( reader.name( c ) + '.' + reader.kind( c ) + ".out", std::ios_base::binary | std::ios_base::out );
+		stream << std::setprecision( 16 );
+		for ( Output_Mapped_Reader::size_type i = 0, n = t.size(); i < n; ++i ) {
+			stream << t[ i ] << '\t' << v[ i ] << '\n';
+		}
+	}
+	return true;
+}
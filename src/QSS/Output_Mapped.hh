@@ -0,0 +1,263 @@
+#ifndef QSS_Output_Mapped_hh_INCLUDED
+#define QSS_Output_Mapped_hh_INCLUDED
+
+// QSS Memory-Mapped Output File
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Fixed-size records are stored directly into a memory-mapped file that grows a chunk at a time
+// Layout (native byte order): A sequence of chunks, each a multiple of the page size until the last is truncated at close
+//  Chunk header: "QSSM" u32 version, u64 capacity (records), u64 records, "DONE"|"LAST"|"OPEN" u32 reserved
+//  Records:      u32 channel, u8 type, u8 kind, u16 name bytes, then f64 t, f64 v for data records or up to 16 name bytes
+// Channel names are records too so a file is self-describing up to any chunk boundary
+// A chunk's record count and DONE marker are stored only when it is full and LAST only at close:
+//  A file from a killed run is readable up to its last complete chunk
+// POSIX only: On other platforms the writer reports that it is unavailable
+
+// QSS Headers
+#include <QSS/Output_Sink.hh>
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// QSS Memory-Mapped Output File Writer
+class Output_Mapped_Writer final : public Output_Sink
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+
+	struct Header
+	{
+		char magic[ 4 ];
+		std::uint32_t version;
+		std::uint64_t capacity; // Records in chunk
+		std::uint64_t n; // Records stored: Set when chunk is complete
+		char state[ 4 ]; // DONE (full) | LAST (closed) | OPEN
+		std::uint32_t reserved;
+	};
+
+	struct Record
+	{
+		std::uint32_t c; // Channel
+		std::uint8_t type; // Record type: Data | Name | Name continuation
+		std::uint8_t kind; // Channel output kind for name records
+		std::uint16_t len; // Name bytes in name records
+		Time t; // Time or first 8 name bytes
+		Value v; // Value or next 8 name bytes
+	};
+
+	enum : std::uint8_t { Data = 0u, Name = 1u, Name_More = 2u }; // Record types
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Output_Mapped_Writer(
+	 std::string const & file_name,
+	 size_type const chunk_bytes = size_type( 64u ) << 20 // Chunk size: Rounded up to a page size multiple
+	);
+
+	// Copy Constructor
+	Output_Mapped_Writer( Output_Mapped_Writer const & ) = delete;
+
+	// Destructor
+	~Output_Mapped_Writer()
+	{
+		close();
+	}
+
+public: // Assignment
+
+	// Copy Assignment
+	Output_Mapped_Writer &
+	operator =( Output_Mapped_Writer const & ) = delete;
+
+public: // Properties
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return fd_ >= 0;
+	}
+
+	// Number of Channels
+	size_type
+	size() const
+	{
+		return n_channels_;
+	}
+
+public: // Methods
+
+	// Add a Channel and Return its Index
+	size_type
+	add( std::string const & name, char const kind );
+
+	// Put a Record
+	void
+	put( size_type const c, Time const t, Value const v )
+	{
+		assert( c < n_channels_ );
+		if ( n_ == capacity_ ) next_chunk();
+		if ( records_ == nullptr ) return; // Mapping failed
+		Record & record( records_[ n_++ ] );
+		record.c = std::uint32_t( c );
+		record.type = Data;
+		record.kind = 0u;
+		record.len = 0u;
+		record.t = t;
+		record.v = v;
+	}
+
+	// Complete Chunk, Truncate, and Close
+	void
+	close();
+
+private: // Methods
+
+	// Complete Current Chunk and Map the Next One
+	void
+	next_chunk();
+
+	// Complete and Unmap Current Chunk
+	void
+	complete_chunk( char const * state );
+
+private: // Data
+
+	int fd_{ -1 }; // File descriptor
+	size_type chunk_bytes_{ 0u }; // Chunk size
+	std::uint64_t chunk_offset_{ 0u }; // Current chunk file offset
+	Header * header_{ nullptr }; // Current chunk header
+	Record * records_{ nullptr }; // Current chunk records
+	size_type capacity_{ 0u }; // Records per chunk
+	size_type n_{ 0u }; // Records in current chunk
+	size_type n_channels_{ 0u }; // Channels
+
+};
+
+// QSS Memory-Mapped Output File Reader
+class Output_Mapped_Reader
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+	using Times = std::vector< Time >;
+	using Values = std::vector< Value >;
+
+private: // Types
+
+	struct Channel
+	{
+		std::string name; // Variable name
+		char kind{ 'x' }; // Output kind: x, q, f
+		Times t; // Times
+		Values v; // Values
+	};
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Output_Mapped_Reader( std::string const & file_name );
+
+public: // Properties
+
+	// Valid File?
+	bool
+	good() const
+	{
+		return good_;
+	}
+
+	// Closed Cleanly? Otherwise Records are Read up to the Last Complete Chunk
+	bool
+	complete() const
+	{
+		return complete_;
+	}
+
+	// Number of Channels
+	size_type
+	size() const
+	{
+		return channels_.size();
+	}
+
+	// Channel Name
+	std::string const &
+	name( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].name;
+	}
+
+	// Channel Output Kind
+	char
+	kind( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].kind;
+	}
+
+	// Channel Number of Records
+	size_type
+	n_records( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].t.size();
+	}
+
+	// Channel Times
+	Times const &
+	t( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].t;
+	}
+
+	// Channel Values
+	Values const &
+	v( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].v;
+	}
+
+	// Index of Channel with Given Name and Kind: size() if Not Found
+	size_type
+	find( std::string const & name, char const kind ) const;
+
+private: // Data
+
+	bool good_{ false }; // Valid file?
+	bool complete_{ false }; // Closed cleanly?
+	std::vector< Channel > channels_; // Channels
+
+};
+
+// Memory-Mapped Output File Name for a Model: Model Base Name with .qssm Extension
+std::string
+output_mapped_name( std::string const & model );
+
+// Convert a Memory-Mapped Output File to name.kind.out Text Files: Returns Whether Successful
+bool
+output_mapped_to_text( std::string const & file_name );
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef QSS_Output_Memory_hh_INCLUDED
+#define QSS_Output_Memory_hh_INCLUDED
+
+// QSS In-Memory Columnar Results
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Each channel (variable + output kind) keeps contiguous time and value arrays
+// Hosts embedding the solver read the arrays in place after the run: No formatting, parsing, or file I/O
+
+// QSS Headers
+#include <QSS/Memory.hh>
+#include <QSS/Output_Sink.hh>
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// QSS In-Memory Columnar Results
+class Output_Memory final : public Output_Sink
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+	using Times = std::vector< Time >;
+	using Values = std::vector< Value >;
+
+private: // Types
+
+	struct Channel
+	{
+		std::string name; // Variable name
+		char kind{ 'x' }; // Output kind: x, q, f
+		Times t; // Times
+		Values v; // Values
+	};
+
+public: // Creation
+
+	// Default Constructor
+	Output_Memory()
+	{}
+
+public: // Properties
+
+	// Number of Channels
+	size_type
+	size() const
+	{
+		return channels_.size();
+	}
+
+	// Heap Bytes
+	size_type
+	heap_bytes() const
+	{
+		size_type n( Memory::heap( channels_ ) );
+		for ( Channel const & channel : channels_ ) n += Memory::heap( channel.name ) + Memory::heap( channel.t ) + Memory::heap( channel.v );
+		return n;
+	}
+
+	// Channel Variable Name
+	std::string const &
+	name( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].name;
+	}
+
+	// Channel Output Kind
+	char
+	kind( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].kind;
+	}
+
+	// Channel Records
+	size_type
+	n_records( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].t.size();
+	}
+
+	// Channel Times
+	Times const &
+	t( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].t;
+	}
+
+	// Channel Values
+	Values const &
+	v( size_type const c ) const
+	{
+		assert( c < channels_.size() );
+		return channels_[ c ].v;
+	}
+
+	// Index of Channel with Given Variable Name and Kind: size() if Not Found
+	size_type
+	find( std::string const & name, char const kind ) const
+	{
+		for ( size_type c = 0, e = channels_.size(); c < e; ++c ) {
+			if ( ( channels_[ c ].kind == kind ) && ( channels_[ c ].name == name ) ) return c;
+		}
+		return channels_.size();
+	}
+
+public: // Methods
+
+	// Add a Channel and Return its Index
+	size_type
+	add( std::string const & name, char const kind )
+	{
+		channels_.push_back( Channel() );
+		channels_.back().name = name;
+		channels_.back().kind = kind;
+		return channels_.size() - 1u;
+	}
+
+	// Put a Record
+	void
+	put( size_type const c, Time const t, Value const v )
+	{
+		assert( c < channels_.size() );
+		Channel & channel( channels_[ c ] );
+		channel.t.push_back( t );
+		channel.v.push_back( v );
+	}
+
+	// Release Excess Capacity
+	void
+	shrink()
+	{
+		for ( Channel & channel : channels_ ) {
+			channel.t.shrink_to_fit();
+			channel.v.shrink_to_fit();
+		}
+	}
+
+private: // Data
+
+	std::vector< Channel > channels_; // Channels
+
+};
+
+#endif
@@ -0,0 +1,67 @@
+// QSS Asynchronous Output Queue
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Output_Queue.hh>
+#include <QSS/Output.hh>
+
+// C++ Headers
+#include <chrono>
+
+// Constructor
+Output_Queue::
+Output_Queue(
+ size_type const capacity,
+ bool const drop
+) :
+ drop_( drop )
+{
+	size_type n( 2u );
+	while ( n < capacity ) n <<= 1;
+	ring_.resize( n );
+	mask_ = n - 1u;
+	writer_ = std::thread( &Output_Queue::run, this );
+}
+
+// Write All Queued Records and Stop the Writer Thread
+void
+Output_Queue::
+stop()
+{
+	if ( writer_.joinable() ) {
+		stop_.store( true, std::memory_order_release );
+		writer_.join();
+	}
+}
+
+// Writer Thread Loop
+void
+Output_Queue::
+run()
+{
+	int idle( 0 ); // Empty polls in a row
+	while ( true ) {
+		size_type head( head_.load( std::memory_order_relaxed ) );
+		size_type const tail( tail_.load( std::memory_order_acquire ) );
+		if ( head == tail ) { // Empty
+			if ( stop_.load( std::memory_order_acquire ) && ( tail_.load( std::memory_order_acquire ) == head ) ) return;
+			if ( ++idle < 64 ) {
+				std::this_thread::yield();
+			} else { // Back off when the solver isn't producing output
+				std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+			}
+			continue;
+		}
+		idle = 0;
+		while ( head != tail ) {
+			Record const & record( ring_[ head & mask_ ] );
+			record.out->write( record.i, record.t, record.v );
+			head_.store( ++head, std::memory_order_release );
+		}
+	}
+}
@@ -0,0 +1,169 @@
+#ifndef QSS_Output_Queue_hh_INCLUDED
+#define QSS_Output_Queue_hh_INCLUDED
+
+// QSS Asynchronous Output Queue
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// The solver thread pushes (output, channel, t, value) records into a lock-free single-producer single-consumer ring buffer
+// A background thread pops the records and does the formatting and file writes
+// Backpressure when the ring is full:
+//  Block: The solver waits for space
+//  Drop:  Requantization records are dropped until the ring is half empty: Sampled and end point records still block
+//   Drop mode requires sampled output so every channel keeps a complete sampled trajectory: The drop count is reported at the end of the run
+
+// QSS Headers
+#include <QSS/Memory.hh>
+
+// C++ Headers
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Forward
+class Output;
+
+// QSS Asynchronous Output Queue
+class Output_Queue
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+
+private: // Types
+
+	struct Record
+	{
+		Output * out; // Output the record is for
+		size_type i; // Output channel index
+		Time t; // Time
+		Value v; // Value
+	};
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Output_Queue(
+	 size_type const capacity, // Ring buffer records: Rounded up to a power of 2
+	 bool const drop = false // Drop requantization records when full?
+	);
+
+	// Copy Constructor
+	Output_Queue( Output_Queue const & ) = delete;
+
+	// Destructor
+	~Output_Queue()
+	{
+		stop();
+	}
+
+public: // Assignment
+
+	// Copy Assignment
+	Output_Queue &
+	operator =( Output_Queue const & ) = delete;
+
+public: // Properties
+
+	// Ring Buffer Capacity
+	size_type
+	capacity() const
+	{
+		return ring_.size();
+	}
+
+	// Requantization Records Dropped
+	size_type
+	n_dropped() const
+	{
+		return n_dropped_;
+	}
+
+	// Times the Solver Waited for Space
+	size_type
+	n_blocked() const
+	{
+		return n_blocked_;
+	}
+
+	// Heap Bytes
+	size_type
+	heap_bytes() const
+	{
+		return Memory::heap( ring_ );
+	}
+
+public: // Methods
+
+	// Push a Record: Returns Whether Queued
+	bool
+	push( Output * out, size_type const i, Time const t, Value const v, bool const droppable = false )
+	{
+		size_type const tail( tail_.load( std::memory_order_relaxed ) );
+		size_type const capacity( ring_.size() );
+		if ( dropping_ ) { // Drop requantization records until half empty
+			if ( tail - head_.load( std::memory_order_acquire ) > ( capacity >> 1 ) ) {
+				if ( droppable ) {
+					++n_dropped_;
+					return false;
+				}
+			} else {
+				dropping_ = false;
+			}
+		}
+		if ( tail - head_.load( std::memory_order_acquire ) >= capacity ) { // Full
+			if ( drop_ && droppable ) {
+				dropping_ = true;
+				++n_dropped_;
+				return false;
+			}
+			++n_blocked_;
+			do {
+				std::this_thread::yield();
+			} while ( tail - head_.load( std::memory_order_acquire ) >= capacity );
+		}
+		Record & record( ring_[ tail & mask_ ] );
+		record.out = out;
+		record.i = i;
+		record.t = t;
+		record.v = v;
+		tail_.store( tail + 1u, std::memory_order_release );
+		return true;
+	}
+
+	// Write All Queued Records and Stop the Writer Thread
+	void
+	stop();
+
+private: // Methods
+
+	// Writer Thread Loop
+	void
+	run();
+
+private: // Data
+
+	std::vector< Record > ring_; // Ring buffer
+	size_type mask_{ 0u }; // Ring index mask
+	bool drop_{ false }; // Drop requantization records when full?
+	bool dropping_{ false }; // Dropping requantization records?
+	size_type n_dropped_{ 0u }; // Requantization records dropped
+	size_type n_blocked_{ 0u }; // Times the solver waited for space
+	std::atomic< size_type > head_{ 0u }; // Next record to write: Advanced by writer thread
+	std::atomic< size_type > tail_{ 0u }; // Next free slot: Advanced by solver thread
+	std::atomic< bool > stop_{ false }; // Stop when empty?
+	std::thread writer_; // Writer thread
+
+};
+
+#endif
@@ -0,0 +1,108 @@
+// QSS Sampled Output Engine
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Output_Sampler.hh>
+
+// Initialize Arrays
+void
+Output_Sampler::
+init()
+{
+	size_type const n( vars_.size() );
+	changed_flags_.assign( n, false );
+	changed_.reserve( n );
+	if ( do_x_ ) {
+		tX_.resize( n );
+		x0_.resize( n );
+		x1_.resize( n );
+		x2_.resize( n );
+		x3_.resize( n );
+		x_.resize( n );
+	}
+	if ( do_q_ ) {
+		tQ_.resize( n );
+		q0_.resize( n );
+		q1_.resize( n );
+		q2_.resize( n );
+		q_.resize( n );
+	}
+}
+
+// Sample All Variables at Time t
+void
+Output_Sampler::
+sample( Time const t )
+{
+	refresh();
+	size_type const n( vars_.size() );
+	if ( do_x_ ) { // Same Horner form as the Variable x( t ) methods so values match
+		Time const * tX( tX_.data() );
+		Value const * c0( x0_.data() ), * c1( x1_.data() ), * c2( x2_.data() ), * c3( x3_.data() );
+		Value * x( x_.data() );
+		for ( size_type i = 0; i < n; ++i ) {
+			Time const tDel( t - tX[ i ] );
+			x[ i ] = c0[ i ] + ( ( c1[ i ] + ( ( c2[ i ] + ( c3[ i ] * tDel ) ) * tDel ) ) * tDel );
+		}
+	}
+	if ( do_q_ ) {
+		Time const * tQ( tQ_.data() );
+		Value const * c0( q0_.data() ), * c1( q1_.data() ), * c2( q2_.data() );
+		Value * q( q_.data() );
+		for ( size_type i = 0; i < n; ++i ) {
+			Time const tDel( t - tQ[ i ] );
+			q[ i ] = c0[ i ] + ( ( c1[ i ] + ( c2[ i ] * tDel ) ) * tDel );
+		}
+	}
+}
+
+// Refresh Coefficients of Variable i
+void
+Output_Sampler::
+refresh( size_type const i )
+{
+	Variable const * var( vars_[ i ] );
+	if ( do_x_ ) {
+		Value c[ 4 ];
+		var->x_coefficients( c );
+		tX_[ i ] = var->tX;
+		x0_[ i ] = c[ 0 ];
+		x1_[ i ] = c[ 1 ];
+		x2_[ i ] = c[ 2 ];
+		x3_[ i ] = c[ 3 ];
+	}
+	if ( do_q_ ) {
+		Value c[ 3 ];
+		var->q_coefficients( c );
+		tQ_[ i ] = var->tQ;
+		q0_[ i ] = c[ 0 ];
+		q1_[ i ] = c[ 1 ];
+		q2_[ i ] = c[ 2 ];
+	}
+}
+
+// Refresh Coefficients of Changed Variables
+void
+Output_Sampler::
+refresh()
+{
+	if ( all_changed_ ) {
+		for ( size_type i = 0, n = vars_.size(); i < n; ++i ) {
+			refresh( i );
+		}
+		all_changed_ = false;
+	} else {
+		for ( size_type const i : changed_ ) {
+			refresh( i );
+		}
+	}
+	for ( size_type const i : changed_ ) {
+		changed_flags_[ i ] = false;
+	}
+	changed_.clear();
+}
@@ -0,0 +1,151 @@
+#ifndef QSS_Output_Sampler_hh_INCLUDED
+#define QSS_Output_Sampler_hh_INCLUDED
+
+// QSS Sampled Output Engine
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Keeps the continuous and quantized polynomial coefficients of all variables in structure of arrays form
+// Only variables marked as changed since the last sample are refreshed from their Variable objects
+// Each sample then evaluates all trajectories in one branch-free sweep over the arrays instead of two virtual calls per variable
+
+// QSS Headers
+#include <QSS/Memory.hh>
+#include <QSS/Variable.hh>
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+// QSS Sampled Output Engine
+class Output_Sampler
+{
+
+public: // Types
+
+	using Variables = Variable::Variables;
+	using size_type = Variables::size_type;
+	using Time = Variable::Time;
+	using Value = Variable::Value;
+	using Times = std::vector< Time >;
+	using Values = std::vector< Value >;
+
+public: // Creation
+
+	// Constructor from a Collection of Variable Pointers
+	template< typename Vars >
+	Output_Sampler(
+	 Vars const & vars,
+	 bool const do_x, // Sample continuous trajectories?
+	 bool const do_q // Sample quantized trajectories?
+	) :
+	 vars_( vars.begin(), vars.end() ),
+	 do_x_( do_x ),
+	 do_q_( do_q )
+	{
+		init();
+	}
+
+public: // Properties
+
+	// Number of Variables
+	size_type
+	size() const
+	{
+		return vars_.size();
+	}
+
+	// Continuous Value of Variable i at Last Sample Time
+	Value
+	x( size_type const i ) const
+	{
+		assert( do_x_ );
+		assert( i < x_.size() );
+		return x_[ i ];
+	}
+
+	// Quantized Value of Variable i at Last Sample Time
+	Value
+	q( size_type const i ) const
+	{
+		assert( do_q_ );
+		assert( i < q_.size() );
+		return q_[ i ];
+	}
+
+	// Heap Bytes
+	size_type
+	heap_bytes() const
+	{
+		return Memory::heap( vars_ ) + Memory::heap( changed_flags_ ) + Memory::heap( changed_ ) + Memory::heap( tX_ ) + Memory::heap( x0_ ) + Memory::heap( x1_ ) + Memory::heap( x2_ ) + Memory::heap( x3_ ) + Memory::heap( tQ_ ) + Memory::heap( q0_ ) + Memory::heap( q1_ ) + Memory::heap( q2_ ) + Memory::heap( x_ ) + Memory::heap( q_ );
+	}
+
+public: // Methods
+
+	// Mark Variable i as Changed
+	void
+	changed( size_type const i )
+	{
+		assert( i < vars_.size() );
+		if ( ! changed_flags_[ i ] ) {
+			changed_flags_[ i ] = true;
+			changed_.push_back( i );
+		}
+	}
+
+	// Mark All Variables as Changed
+	void
+	changed_all()
+	{
+		all_changed_ = true;
+	}
+
+	// Sample All Variables at Time t
+	void
+	sample( Time const t );
+
+private: // Methods
+
+	// Initialize Arrays
+	void
+	init();
+
+	// Refresh Coefficients of Variable i
+	void
+	refresh( size_type const i );
+
+	// Refresh Coefficients of Changed Variables
+	void
+	refresh();
+
+private: // Data
+
+	Variables vars_; // Variables
+	bool do_x_{ true }; // Sample continuous trajectories?
+	bool do_q_{ false }; // Sample quantized trajectories?
+
+	// Changed variables
+	std::vector< bool > changed_flags_; // Changed since last sample?
+	std::vector< size_type > changed_; // Changed since last sample
+	bool all_changed_{ true }; // All changed since last sample?
+
+	// Continuous representation coefficients
+	Times tX_;
+	Values x0_, x1_, x2_, x3_;
+
+	// Quantized representation coefficients
+	Times tQ_;
+	Values q0_, q1_, q2_;
+
+	// Sampled values
+	Values x_;
+	Values q_;
+
+};
+
+#endif
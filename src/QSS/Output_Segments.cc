@@ -0,0 +1,223 @@
+// QSS Trajectory Segments Output File
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Output_Segments.hh>
+#include <QSS/Output_Binary.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+namespace { // Internal
+
+// File Magic Tag
+char const magic[ 4 ] = { 'Q', 'S', 'S', 'P' };
+
+// File Format Version
+std::uint32_t const version( 1u );
+
+// Write a Binary Value
+template< typename T >
+inline
+void
+write_bin( std::ostream & stream, T const & val )
+{
+	stream.write( reinterpret_cast< char const * >( &val ), sizeof( T ) );
+}
+
+// Read a Binary Value
+template< typename T >
+inline
+bool
+read_bin( std::istream & stream, T & val )
+{
+	return bool( stream.read( reinterpret_cast< char * >( &val ), sizeof( T ) ) );
+}
+
+} // Internal
+
+// Constructor
+Output_Segments_Writer::
+Output_Segments_Writer( std::string const & file_name ) :
+ stream_( file_name, std::ios_base::binary | std::ios_base::out )
+{
+	if ( ! stream_ ) {
+		std::cerr << "Error: Segments output file could not be opened: " << file_name << std::endl;
+		return;
+	}
+	stream_.write( magic, sizeof( magic ) );
+	write_bin( stream_, version );
+}
+
+// Put a Segment
+void
+Output_Segments_Writer::
+put( size_type const i, Time const tX, int const order, Value const * c )
+{
+	assert( i < names_.size() );
+	assert( ( 0 <= order ) && ( order <= 3 ) );
+	write_bin( stream_, std::uint32_t( i ) );
+	write_bin( stream_, std::uint8_t( order ) );
+	write_bin( stream_, tX );
+	stream_.write( reinterpret_cast< char const * >( c ), ( order + 1 ) * sizeof( Value ) );
+	tEnd_ = std::max( tEnd_, tX );
+}
+
+// Write Index and Close
+void
+Output_Segments_Writer::
+close( Time const tEnd )
+{
+	if ( ! stream_.is_open() ) return;
+	std::uint64_t const index_offset( stream_.tellp() );
+	write_bin( stream_, std::uint32_t( names_.size() ) );
+	for ( std::string const & name : names_ ) {
+		write_bin( stream_, std::uint32_t( name.length() ) );
+		stream_.write( name.data(), name.length() );
+	}
+	write_bin( stream_, tEnd );
+	write_bin( stream_, index_offset );
+	stream_.write( magic, sizeof( magic ) );
+	stream_.close();
+}
+
+// Constructor
+Output_Segments_Reader::
+Output_Segments_Reader( std::string const & file_name )
+{
+	std::ifstream stream( file_name, std::ios_base::binary | std::ios_base::in );
+	if ( ! stream ) return;
+
+	// Preamble
+	char tag[ 4 ];
+	std::uint32_t file_version( 0u );
+	if ( ! ( stream.read( tag, sizeof( tag ) ) && ( std::memcmp( tag, magic, sizeof( magic ) ) == 0 ) ) ) return;
+	if ( ! ( read_bin( stream, file_version ) && ( file_version == version ) ) ) return;
+	std::streamoff const segments_offset( stream.tellg() );
+
+	// Trailer
+	std::uint64_t index_offset( 0u );
+	if ( ! stream.seekg( -std::streamoff( sizeof( index_offset ) + sizeof( magic ) ), std::ios_base::end ) ) return; // No trailer: Run didn't close the file
+	if ( ! read_bin( stream, index_offset ) ) return;
+	if ( ! ( stream.read( tag, sizeof( tag ) ) && ( std::memcmp( tag, magic, sizeof( magic ) ) == 0 ) ) ) return;
+
+	// Index
+	if ( ! stream.seekg( index_offset ) ) return;
+	std::uint32_t n_vars( 0u );
+	if ( ! read_bin( stream, n_vars ) ) return;
+	names_.resize( n_vars );
+	for ( std::string & name : names_ ) {
+		std::uint32_t name_len( 0u );
+		if ( ! read_bin( stream, name_len ) ) return;
+		name.resize( name_len );
+		if ( ( name_len > 0u ) && ( ! stream.read( &name[ 0 ], name_len ) ) ) return;
+	}
+	if ( ! read_bin( stream, tEnd_ ) ) return;
+
+	// Segments
+	segments_.resize( n_vars );
+	if ( ! stream.seekg( segments_offset ) ) return;
+	tBeg_ = std::numeric_limits< Time >::max();
+	while ( std::uint64_t( stream.tellg() ) < index_offset ) {
+		std::uint32_t i( 0u );
+		std::uint8_t order( 0u );
+		Segment s{ 0.0, 0, { 0.0, 0.0, 0.0, 0.0 } };
+		if ( ! ( read_bin( stream, i ) && read_bin( stream, order ) && read_bin( stream, s.tX ) ) ) return;
+		if ( ( i >= n_vars ) || ( order > 3u ) ) return;
+		s.order = order;
+		if ( ! stream.read( reinterpret_cast< char * >( s.c ), ( order + 1u ) * sizeof( Value ) ) ) return;
+		Segments & segments( segments_[ i ] );
+		if ( segments.empty() || ( segments.back().tX < s.tX ) ) {
+			segments.push_back( s );
+		} else if ( segments.back().tX == s.tX ) { // Representation updated again at the same time
+			segments.back() = s;
+		} else { // Out of order
+			return;
+		}
+		tBeg_ = std::min( tBeg_, s.tX );
+	}
+	if ( tBeg_ > tEnd_ ) tBeg_ = tEnd_;
+	good_ = true;
+}
+
+// Index of Variable with Given Name: size() if Not Found
+Output_Segments_Reader::size_type
+Output_Segments_Reader::
+find( std::string const & name ) const
+{
+	return std::find( names_.begin(), names_.end(), name ) - names_.begin();
+}
+
+// Value of Variable i at Time t
+Output_Segments_Reader::Value
+Output_Segments_Reader::
+x( size_type const i, Time const t ) const
+{
+	Segments const & segments( segments_[ i ] );
+	assert( ! segments.empty() );
+	auto s( std::upper_bound( segments.begin(), segments.end(), t, []( Time const t, Segment const & s ){ return t < s.tX; } ) );
+	if ( s != segments.begin() ) --s; // Segment containing t: First segment for t before start
+	return x( *s, t );
+}
+
+// Values of Variable i at Sorted Times
+void
+Output_Segments_Reader::
+x( size_type const i, Times const & t, Values & v ) const
+{
+	Segments const & segments( segments_[ i ] );
+	assert( ! segments.empty() );
+	v.resize( t.size() );
+	size_type j( 0u ), m( segments.size() );
+	for ( size_type k = 0, n = t.size(); k < n; ++k ) {
+		while ( ( j + 1u < m ) && ( segments[ j + 1u ].tX <= t[ k ] ) ) ++j; // Sweep forward
+		v[ k ] = x( segments[ j ], t[ k ] );
+	}
+}
+
+// Trajectory Segments File Name for a Model: Model Base Name with .seg Extension
+std::string
+output_segments_name( std::string const & model )
+{
+	std::string name( output_binary_name( model ) ); // Model base name with .qss extension
+	return name.replace( name.length() - 4u, 4u, ".seg" );
+}
+
+// Convert a Trajectory Segments File to name.x.out Text Files Sampled at Time Step dt: Returns Whether Successful
+bool
+output_segments_to_text( std::string const & file_name, double const dt )
+{
+	Output_Segments_Reader reader( file_name );
+	if ( ! reader.good() ) {
+		std::cerr << "Error: Not a complete QSS trajectory segments file: " << file_name << std::endl;
+		return false;
+	}
+	Output_Segments_Reader::Times t;
+	Output_Segments_Reader::Time const tBeg( reader.tBeg() );
+	Output_Segments_Reader::Time const tEnd( reader.tEnd() );
+	t.push_back( tBeg );
+	if ( dt > 0.0 ) {
+		for ( std::size_t k = 1; tBeg + k * dt < tEnd; ++k ) t.push_back( tBeg + k * dt ); // Same sample times as the solver
+	}
+	if ( tEnd > tBeg ) t.push_back( tEnd );
+	Output_Segments_Reader::Values v;
+	for ( Output_Segments_Reader::size_type i = 0, e = reader.size(); i < e; ++i ) {
+		if ( reader.segments( i ).empty() ) continue;
+		reader.x( i, t, v );
+		std::ofstream stream( reader.name( i ) + ".x.out", std::ios_base::binary | std::ios_base::out );
+		stream << std::setprecision( 16 );
+		for ( std::size_t k = 0, n = t.size(); k < n; ++k ) {
+			stream << t[ k ] << '\t' << v[ k ] << '\n';
+		}
+	}
+	return true;
+}
@@ -0,0 +1,225 @@
+#ifndef QSS_Output_Segments_hh_INCLUDED
+#define QSS_Output_Segments_hh_INCLUDED
+
+// QSS Trajectory Segments Output File
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Each change of a variable's continuous representation is recorded as a polynomial segment
+// The segment is valid from its tX to the next segment's tX (or the end time) so any time grid can be evaluated exactly afterwards
+// Layout (native byte order):
+//  Preamble: "QSSP" u32 version
+//  Segments: u32 variable, u8 order, f64 tX, f64 c[order+1]  (x(t) = c[0] + c[1] d + ... for d = t - tX)
+//  Index:    u32 variables, then per variable: u32 name length, name; f64 end time
+//  Trailer:  u64 index offset, "QSSP"
+
+// QSS Headers
+#include <QSS/Memory.hh>
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// QSS Trajectory Segments Output File Writer
+class Output_Segments_Writer
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Output_Segments_Writer( std::string const & file_name );
+
+	// Copy Constructor
+	Output_Segments_Writer( Output_Segments_Writer const & ) = delete;
+
+	// Destructor
+	~Output_Segments_Writer()
+	{
+		close( tEnd_ );
+	}
+
+public: // Assignment
+
+	// Copy Assignment
+	Output_Segments_Writer &
+	operator =( Output_Segments_Writer const & ) = delete;
+
+public: // Properties
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return stream_.is_open();
+	}
+
+	// Number of Variables
+	size_type
+	size() const
+	{
+		return names_.size();
+	}
+
+	// Heap Bytes
+	size_type
+	heap_bytes() const
+	{
+		return Memory::heap( names_ ) + ( stream_.is_open() ? Memory::stream_buffer() : 0u );
+	}
+
+public: // Methods
+
+	// Add a Variable and Return its Index
+	size_type
+	add( std::string const & name )
+	{
+		names_.push_back( name );
+		return names_.size() - 1u;
+	}
+
+	// Put a Segment
+	void
+	put( size_type const i, Time const tX, int const order, Value const * c );
+
+	// Write Index and Close
+	void
+	close( Time const tEnd );
+
+private: // Data
+
+	std::ofstream stream_; // Output file stream
+	std::vector< std::string > names_; // Variable names
+	Time tEnd_{ 0.0 }; // End time: Last segment time if not closed explicitly
+
+};
+
+// QSS Trajectory Segments Output File Reader
+class Output_Segments_Reader
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+	using Times = std::vector< Time >;
+	using Values = std::vector< Value >;
+
+	struct Segment
+	{
+		Time tX; // Segment start time
+		int order; // Polynomial order
+		Value c[ 4 ]; // Coefficients: Zero above order
+	};
+
+	using Segments = std::vector< Segment >;
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Output_Segments_Reader( std::string const & file_name );
+
+public: // Properties
+
+	// Valid File?
+	bool
+	good() const
+	{
+		return good_;
+	}
+
+	// Number of Variables
+	size_type
+	size() const
+	{
+		return names_.size();
+	}
+
+	// Variable Name
+	std::string const &
+	name( size_type const i ) const
+	{
+		assert( i < names_.size() );
+		return names_[ i ];
+	}
+
+	// Variable Segments
+	Segments const &
+	segments( size_type const i ) const
+	{
+		assert( i < segments_.size() );
+		return segments_[ i ];
+	}
+
+	// Start Time
+	Time
+	tBeg() const
+	{
+		return tBeg_;
+	}
+
+	// End Time
+	Time
+	tEnd() const
+	{
+		return tEnd_;
+	}
+
+	// Index of Variable with Given Name: size() if Not Found
+	size_type
+	find( std::string const & name ) const;
+
+public: // Methods
+
+	// Value of Variable i at Time t
+	Value
+	x( size_type const i, Time const t ) const;
+
+	// Values of Variable i at Sorted Times
+	void
+	x( size_type const i, Times const & t, Values & v ) const;
+
+	// Segment Value at Time t
+	static
+	Value
+	x( Segment const & s, Time const t )
+	{
+		Time const d( t - s.tX );
+		return s.c[ 0 ] + ( ( s.c[ 1 ] + ( s.c[ 2 ] + ( s.c[ 3 ] * d ) ) * d ) * d );
+	}
+
+private: // Data
+
+	bool good_{ false }; // Valid file?
+	std::vector< std::string > names_; // Variable names
+	std::vector< Segments > segments_; // Variable segments
+	Time tBeg_{ 0.0 }; // Start time
+	Time tEnd_{ 0.0 }; // End time
+
+};
+
+// Trajectory Segments File Name for a Model: Model Base Name with .seg Extension
+std::string
+output_segments_name( std::string const & model );
+
+// Convert a Trajectory Segments File to name.x.out Text Files Sampled at Time Step dt: Returns Whether Successful
+bool
+output_segments_to_text( std::string const & file_name, double const dt );
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef QSS_Output_Sink_hh_INCLUDED
+#define QSS_Output_Sink_hh_INCLUDED
+
+// QSS Results Sink Interface
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Output channels (variable + output kind) can go to a sink instead of one text file per channel
+// Implementations: Output_Binary_Writer (binary columnar file), Output_Mapped_Writer (memory-mapped file),
+//  Output_Memory (in-memory columnar buffers), and Output_Stream_Writer (live socket/FIFO stream)
+
+// C++ Headers
+#include <cstddef>
+#include <string>
+
+// QSS Results Sink Interface
+class Output_Sink
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+
+protected: // Creation
+
+	// Default Constructor
+	Output_Sink()
+	{}
+
+	// Copy Constructor
+	Output_Sink( Output_Sink const & ) = default;
+
+public: // Creation
+
+	// Destructor
+	virtual
+	~Output_Sink()
+	{}
+
+protected: // Assignment
+
+	// Copy Assignment
+	Output_Sink &
+	operator =( Output_Sink const & ) = default;
+
+public: // Properties
+
+	// Heap Bytes
+	virtual
+	size_type
+	heap_bytes() const
+	{
+		return 0u;
+	}
+
+public: // Methods
+
+	// Add a Channel and Return its Index
+	virtual
+	size_type
+	add( std::string const & name, char const kind ) = 0;
+
+	// Put a Record
+	virtual
+	void
+	put( size_type const c, Time const t, Value const v ) = 0;
+
+};
+
+#endif
@@ -0,0 +1,299 @@
+// QSS Live Output Stream
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Output_Stream.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <iostream>
+
+// POSIX Headers
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace { // Internal
+
+// Stream Magic Tag
+char const magic[ 4 ] = { 'Q', 'S', 'S', 'S' };
+
+// Stream Format Version
+std::uint32_t const version( 1u );
+
+static_assert( sizeof( Output_Stream_Writer::Header ) == 8u, "Stream message header must be 8 bytes" );
+
+// Append Bytes to a Buffer
+inline
+void
+append_bytes( std::vector< char > & buffer, void const * bytes, std::size_t const n )
+{
+	char const * p( static_cast< char const * >( bytes ) );
+	buffer.insert( buffer.end(), p, p + n );
+}
+
+} // Internal
+
+// Constructor
+Output_Stream_Writer::
+Output_Stream_Writer(
+ std::string const & path,
+ size_type const batch_bytes,
+ size_type const pending_batches
+) :
+ path_( path ),
+ batch_bytes_( std::max( batch_bytes, size_type( 1u ) ) ),
+ pending_max_( std::max( pending_batches, size_type( 1u ) ) * batch_bytes_ )
+{
+	batch_.reserve( batch_bytes_ + sizeof( Header ) + sizeof( Time ) + sizeof( Value ) );
+#ifndef _WIN32
+	struct stat st;
+	if ( ( ::stat( path.c_str(), &st ) == 0 ) && S_ISFIFO( st.st_mode ) ) { // Named pipe
+		fifo_ = true;
+		std::signal( SIGPIPE, SIG_IGN ); // A monitor closing its end must not kill the run: write reports EPIPE instead
+		return;
+	}
+	::sockaddr_un addr;
+	std::memset( &addr, 0, sizeof( addr ) );
+	addr.sun_family = AF_UNIX;
+	if ( path.length() >= sizeof( addr.sun_path ) ) {
+		std::cerr << "Error: Output stream socket path is too long: " << path << std::endl;
+		return;
+	}
+	std::strcpy( addr.sun_path, path.c_str() );
+	if ( ( ::lstat( path.c_str(), &st ) == 0 ) && S_ISSOCK( st.st_mode ) ) ::unlink( path.c_str() ); // Stale socket from an earlier run
+	listen_fd_ = ::socket( AF_UNIX, SOCK_STREAM, 0 );
+	if ( ( listen_fd_ < 0 ) ||
+	 ( ::fcntl( listen_fd_, F_SETFL, ::fcntl( listen_fd_, F_GETFL ) | O_NONBLOCK ) < 0 ) ||
+	 ( ::bind( listen_fd_, reinterpret_cast< ::sockaddr const * >( &addr ), sizeof( addr ) ) < 0 ) ||
+	 ( ::listen( listen_fd_, 1 ) < 0 ) ) {
+		std::cerr << "Error: Output stream socket could not be opened: " << path << std::endl;
+		if ( listen_fd_ >= 0 ) ::close( listen_fd_ );
+		listen_fd_ = -1;
+	}
+#else
+	(void)pending_batches;
+	std::cerr << "Error: Output streams are not supported on this platform: " << path << std::endl;
+#endif
+}
+
+// Add a Channel and Return its Index
+Output_Stream_Writer::size_type
+Output_Stream_Writer::
+add( std::string const & name, char const kind )
+{
+	channels_.push_back( Channel() );
+	Channel & channel( channels_.back() );
+	channel.name = name;
+	channel.kind = kind;
+	if ( connected() ) { // Send to the current monitor: Later monitors get all names on connection
+		Header const header{ std::uint32_t( channels_.size() - 1u ), Name, std::uint8_t( kind ), std::uint16_t( name.length() ) };
+		append_bytes( pending_, &header, sizeof( Header ) );
+		append_bytes( pending_, name.data(), name.length() );
+		pending_.resize( pending_.size() + ( ( 8u - ( name.length() & 7u ) ) & 7u ), '\0' );
+	}
+	return channels_.size() - 1u;
+}
+
+// Send the Current Batch Without Blocking
+void
+Output_Stream_Writer::
+flush()
+{
+	flushed_ = Clock::now();
+	if ( connect() && send() ) {
+		if ( ( pending_.size() - sent_ ) + batch_.size() <= pending_max_ ) {
+			pending_.insert( pending_.end(), batch_.begin(), batch_.end() );
+			n_batch_ = 0u;
+			if ( ! send() ) disconnect();
+		}
+	} else if ( connected() ) { // Monitor went away
+		disconnect();
+	}
+	n_dropped_ += n_batch_;
+	n_batch_ = 0u;
+	batch_.clear();
+}
+
+// Flush and Close
+void
+Output_Stream_Writer::
+close()
+{
+	if ( ! is_open() ) return;
+#ifndef _WIN32
+	flush();
+	Clock::time_point const t_end( Clock::now() + std::chrono::seconds( 1 ) ); // Give a connected monitor a moment to take the rest
+	while ( connected() && ( sent_ < pending_.size() ) && ( Clock::now() < t_end ) ) {
+		::pollfd pfd{ fd_, POLLOUT, 0 };
+		::poll( &pfd, 1, 100 );
+		if ( ! send() ) disconnect();
+	}
+	disconnect();
+	if ( listen_fd_ >= 0 ) {
+		::close( listen_fd_ );
+		::unlink( path_.c_str() );
+	}
+#endif
+	listen_fd_ = -1;
+	fifo_ = false;
+}
+
+// Connect a Monitor if One is Waiting
+bool
+Output_Stream_Writer::
+connect()
+{
+	if ( fd_ >= 0 ) return true;
+#ifndef _WIN32
+	if ( fifo_ ) {
+		fd_ = ::open( path_.c_str(), O_WRONLY | O_NONBLOCK ); // Fails with ENXIO until a reader opens the FIFO
+	} else if ( listen_fd_ >= 0 ) {
+		fd_ = ::accept( listen_fd_, nullptr, nullptr );
+		if ( fd_ >= 0 ) ::fcntl( fd_, F_SETFL, ::fcntl( fd_, F_GETFL ) | O_NONBLOCK );
+	}
+	if ( fd_ < 0 ) return false;
+
+	// Preamble and channel names
+	pending_.clear();
+	sent_ = 0u;
+	append_bytes( pending_, magic, sizeof( magic ) );
+	append_bytes( pending_, &version, sizeof( version ) );
+	for ( size_type c = 0, e = channels_.size(); c < e; ++c ) {
+		Channel const & channel( channels_[ c ] );
+		Header const header{ std::uint32_t( c ), Name, std::uint8_t( channel.kind ), std::uint16_t( channel.name.length() ) };
+		append_bytes( pending_, &header, sizeof( Header ) );
+		append_bytes( pending_, channel.name.data(), channel.name.length() );
+		pending_.resize( pending_.size() + ( ( 8u - ( channel.name.length() & 7u ) ) & 7u ), '\0' );
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+// Drop the Monitor Connection
+void
+Output_Stream_Writer::
+disconnect()
+{
+#ifndef _WIN32
+	if ( fd_ >= 0 ) ::close( fd_ );
+#endif
+	fd_ = -1;
+	pending_.clear();
+	sent_ = 0u;
+}
+
+// Write Pending Bytes Without Blocking: Returns false if the Monitor Went Away
+bool
+Output_Stream_Writer::
+send()
+{
+#ifndef _WIN32
+#ifdef MSG_NOSIGNAL
+	int const flags( MSG_NOSIGNAL );
+#else
+	int const flags( 0 );
+#endif
+	while ( sent_ < pending_.size() ) {
+		char const * p( pending_.data() + sent_ );
+		size_type const n( pending_.size() - sent_ );
+		::ssize_t const w( fifo_ ? ::write( fd_, p, n ) : ::send( fd_, p, n, flags ) );
+		if ( w > 0 ) {
+			sent_ += size_type( w );
+		} else if ( ( w < 0 ) && ( errno == EINTR ) ) {
+			continue;
+		} else if ( ( w < 0 ) && ( ( errno == EAGAIN ) || ( errno == EWOULDBLOCK ) ) ) { // Monitor is lagging
+			break;
+		} else {
+			return false;
+		}
+	}
+	if ( sent_ == pending_.size() ) {
+		pending_.clear();
+		sent_ = 0u;
+	} else if ( sent_ >= pending_.size() / 2u ) { // Compact
+		pending_.erase( pending_.begin(), pending_.begin() + sent_ );
+		sent_ = 0u;
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+// Append Received Bytes
+void
+Output_Stream_Reader::
+append( char const * bytes, size_type const n )
+{
+	if ( pos_ > 0u ) { // Compact
+		buffer_.erase( buffer_.begin(), buffer_.begin() + pos_ );
+		pos_ = 0u;
+	}
+	buffer_.insert( buffer_.end(), bytes, bytes + n );
+}
+
+// Next Data Record: Returns false if None Available
+bool
+Output_Stream_Reader::
+next( size_type & c, Time & t, Value & v )
+{
+	while ( good_ ) {
+		size_type const avail( buffer_.size() - pos_ );
+		char const * p( buffer_.data() + pos_ );
+		if ( ! preamble_ ) {
+			if ( avail < sizeof( magic ) + sizeof( version ) ) return false;
+			std::uint32_t stream_version( 0u );
+			std::memcpy( &stream_version, p + sizeof( magic ), sizeof( stream_version ) );
+			if ( ( std::memcmp( p, magic, sizeof( magic ) ) != 0 ) || ( stream_version != version ) ) {
+				good_ = false;
+				return false;
+			}
+			pos_ += sizeof( magic ) + sizeof( version );
+			preamble_ = true;
+			continue;
+		}
+		if ( avail < sizeof( Header ) ) return false;
+		Header header;
+		std::memcpy( &header, p, sizeof( Header ) );
+		if ( header.type == Output_Stream_Writer::Data ) {
+			if ( avail < sizeof( Header ) + sizeof( Time ) + sizeof( Value ) ) return false;
+			if ( header.c >= names_.size() ) {
+				good_ = false;
+				return false;
+			}
+			c = header.c;
+			std::memcpy( &t, p + sizeof( Header ), sizeof( Time ) );
+			std::memcpy( &v, p + sizeof( Header ) + sizeof( Time ), sizeof( Value ) );
+			pos_ += sizeof( Header ) + sizeof( Time ) + sizeof( Value );
+			return true;
+		} else if ( header.type == Output_Stream_Writer::Name ) {
+			size_type const padded( ( size_type( header.len ) + 7u ) & ~size_type( 7u ) );
+			if ( avail < sizeof( Header ) + padded ) return false;
+			if ( header.c >= names_.size() ) {
+				names_.resize( header.c + 1u );
+				kinds_.resize( header.c + 1u, 'x' );
+			}
+			names_[ header.c ].assign( p + sizeof( Header ), header.len );
+			kinds_[ header.c ] = char( header.kind );
+			pos_ += sizeof( Header ) + padded;
+		} else {
+			good_ = false;
+		}
+	}
+	return false;
+}
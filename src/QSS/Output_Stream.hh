@@ -0,0 +1,259 @@
+#ifndef QSS_Output_Stream_hh_INCLUDED
+#define QSS_Output_Stream_hh_INCLUDED
+
+// QSS Live Output Stream
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Streams output records to a live monitor over a Unix domain socket or a named pipe (FIFO)
+// If the path is an existing FIFO it is opened for writing once a reader has it open
+// Otherwise a listening socket is created at the path and one monitor connection at a time is accepted
+// Protocol (native byte order), repeated for each new connection:
+//  Preamble: "QSSS" u32 version
+//  Messages: u32 channel, u8 type, u8 kind, u16 name bytes, then f64 t, f64 v for data or the name padded to 8 bytes
+//  The channel name messages are sent first on each connection so a monitor can attach at any time
+// Records are batched and written without blocking: While the monitor lags, new batches are dropped rather than stalling the solver
+// Partial batch writes are completed later so the monitor never sees a torn message
+// POSIX only: On other platforms the writer reports that it is unavailable
+
+// QSS Headers
+#include <QSS/Memory.hh>
+#include <QSS/Output_Sink.hh>
+
+// C++ Headers
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// QSS Live Output Stream Writer
+class Output_Stream_Writer final : public Output_Sink
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+	using Clock = std::chrono::steady_clock;
+
+	struct Header
+	{
+		std::uint32_t c; // Channel
+		std::uint8_t type; // Message type: Data | Name
+		std::uint8_t kind; // Channel output kind for name messages
+		std::uint16_t len; // Name bytes in name messages
+	};
+
+	enum : std::uint8_t { Data = 0u, Name = 1u }; // Message types
+
+private: // Types
+
+	struct Channel
+	{
+		std::string name; // Variable name
+		char kind{ 'x' }; // Output kind: x, q, f
+	};
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Output_Stream_Writer(
+	 std::string const & path, // Unix domain socket path or existing FIFO
+	 size_type const batch_bytes = size_type( 64u ) << 10, // Batch size
+	 size_type const pending_batches = 16u // Max unsent batches held for a slow monitor
+	);
+
+	// Copy Constructor
+	Output_Stream_Writer( Output_Stream_Writer const & ) = delete;
+
+	// Destructor
+	~Output_Stream_Writer()
+	{
+		close();
+	}
+
+public: // Assignment
+
+	// Copy Assignment
+	Output_Stream_Writer &
+	operator =( Output_Stream_Writer const & ) = delete;
+
+public: // Properties
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return ( listen_fd_ >= 0 ) || fifo_;
+	}
+
+	// Monitor Connected?
+	bool
+	connected() const
+	{
+		return fd_ >= 0;
+	}
+
+	// Number of Channels
+	size_type
+	size() const
+	{
+		return channels_.size();
+	}
+
+	// Records Dropped While No Monitor Was Connected or the Monitor Lagged
+	std::uint64_t
+	n_dropped() const
+	{
+		return n_dropped_;
+	}
+
+	// Heap Bytes
+	size_type
+	heap_bytes() const
+	{
+		size_type n( Memory::heap( path_ ) + Memory::heap( channels_ ) + Memory::heap( batch_ ) + Memory::heap( pending_ ) );
+		for ( Channel const & channel : channels_ ) n += Memory::heap( channel.name );
+		return n;
+	}
+
+public: // Methods
+
+	// Add a Channel and Return its Index
+	size_type
+	add( std::string const & name, char const kind );
+
+	// Put a Record
+	void
+	put( size_type const c, Time const t, Value const v )
+	{
+		assert( c < channels_.size() );
+		Header const header{ std::uint32_t( c ), Data, 0u, 0u };
+		size_type const b( batch_.size() );
+		batch_.resize( b + sizeof( Header ) + sizeof( Time ) + sizeof( Value ) );
+		char * p( batch_.data() + b );
+		std::memcpy( p, &header, sizeof( Header ) );
+		std::memcpy( p + sizeof( Header ), &t, sizeof( Time ) );
+		std::memcpy( p + sizeof( Header ) + sizeof( Time ), &v, sizeof( Value ) );
+		++n_batch_;
+		if ( batch_.size() >= batch_bytes_ ) {
+			flush();
+		} else if ( ( n_batch_ & 0xFFu ) == 0u ) { // Check the clock now and then so a slow run still streams promptly
+			if ( Clock::now() - flushed_ >= std::chrono::milliseconds( 100 ) ) flush();
+		}
+	}
+
+	// Send the Current Batch Without Blocking
+	void
+	flush();
+
+	// Flush and Close
+	void
+	close();
+
+private: // Methods
+
+	// Connect a Monitor if One is Waiting
+	bool
+	connect();
+
+	// Drop the Monitor Connection
+	void
+	disconnect();
+
+	// Write Pending Bytes Without Blocking: Returns false if the Monitor Went Away
+	bool
+	send();
+
+private: // Data
+
+	std::string path_; // Socket or FIFO path
+	bool fifo_{ false }; // Path is a FIFO?
+	int listen_fd_{ -1 }; // Listening socket
+	int fd_{ -1 }; // Monitor connection
+	size_type batch_bytes_{ size_type( 64u ) << 10 }; // Batch size
+	size_type pending_max_{ size_type( 1u ) << 20 }; // Max unsent bytes
+	std::vector< Channel > channels_; // Channels
+	std::vector< char > batch_; // Current batch
+	std::uint64_t n_batch_{ 0u }; // Records in current batch
+	std::vector< char > pending_; // Unsent bytes
+	size_type sent_{ 0u }; // Bytes of pending_ sent
+	std::uint64_t n_dropped_{ 0u }; // Records dropped
+	Clock::time_point flushed_{ Clock::now() }; // Last flush time
+
+};
+
+// Live Output Stream Reader: Parses the Byte Stream from an Output_Stream_Writer
+class Output_Stream_Reader
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Value = double;
+	using Header = Output_Stream_Writer::Header;
+
+public: // Properties
+
+	// Valid Stream So Far?
+	bool
+	good() const
+	{
+		return good_;
+	}
+
+	// Number of Channels
+	size_type
+	size() const
+	{
+		return names_.size();
+	}
+
+	// Channel Name
+	std::string const &
+	name( size_type const c ) const
+	{
+		assert( c < names_.size() );
+		return names_[ c ];
+	}
+
+	// Channel Output Kind
+	char
+	kind( size_type const c ) const
+	{
+		assert( c < kinds_.size() );
+		return kinds_[ c ];
+	}
+
+public: // Methods
+
+	// Append Received Bytes
+	void
+	append( char const * bytes, size_type const n );
+
+	// Next Data Record: Returns false if None Available
+	bool
+	next( size_type & c, Time & t, Value & v );
+
+private: // Data
+
+	bool good_{ true }; // Valid stream so far?
+	bool preamble_{ false }; // Preamble seen?
+	std::vector< char > buffer_; // Unparsed bytes
+	size_type pos_{ 0u }; // Parse position in buffer_
+	std::vector< std::string > names_; // Channel names
+	std::vector< char > kinds_; // Channel kinds
+
+};
+
+#endif
@@ -0,0 +1,70 @@
+// QSS Parallel Observer Advance
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Parallel.hh>
+#include <QSS/Pool.hh>
+#include <QSS/Variable.hh>
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace parallel {
+
+namespace { // Internal
+
+using size_type = std::size_t;
+
+// Partitioning State: Solver thread only
+std::vector< std::vector< size_type > > parts; // Observer list indexes by worker
+std::vector< unsigned char > advanced; // Observers advanced by the current call
+
+// Worker Advancing a Variable: Hashed From its Address
+size_type
+worker( Variable const * v, size_type const n )
+{
+	return size_type( ( std::uint64_t( reinterpret_cast< std::uintptr_t >( v ) ) * 0x9E3779B97F4A7C15ull ) >> 32u ) % n;
+}
+
+} // Internal
+
+// Observer advance worker pool: nullptr unless --threads > 1
+Pool * pool( nullptr );
+
+// Advance Observers to Time t in Parallel
+void
+advance_observers( Variables const & observers, Time const t )
+{
+	assert( pool != nullptr );
+	size_type const n( observers.size() );
+	size_type const n_workers( pool->size() );
+	parts.resize( n_workers );
+	for ( auto & part : parts ) part.clear();
+	for ( size_type i = 0; i < n; ++i ) parts[ worker( observers[ i ], n_workers ) ].push_back( i );
+	advanced.assign( n, 0u );
+	pool->run( n_workers, [&observers,t]( size_type const k ){
+		for ( size_type const i : parts[ k ] ) {
+			Variable * observer( observers[ i ] );
+			if ( observer->tX < t ) { // Same condition as the observer advance
+				observer->advance_trajectory( t );
+				advanced[ i ] = 1u;
+			}
+		}
+	} );
+	for ( size_type i = 0; i < n; ++i ) {
+		Variable * observer( observers[ i ] );
+		if ( advanced[ i ] ) observer->advance_tE();
+#ifdef QSS_STATS
+		++observer->stats.n_observer;
+#endif
+	}
+}
+
+} // parallel
@@ -0,0 +1,38 @@
+#ifndef QSS_Parallel_hh_INCLUDED
+#define QSS_Parallel_hh_INCLUDED
+
+// QSS Parallel Observer Advance
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Observer continuous trajectories are advanced on the worker pool: End times and event queue updates are then made on the solver thread in observer list order
+// Trajectory advances only read observee quantized trajectories, which observer advances don't change, so observers that observe each other can advance concurrently
+// Each call partitions the observer list across the workers in one pass: Partitions are by address so repeats in a list advance once on the same worker
+// Results are identical to the serial observer advance
+
+// C++ Headers
+#include <vector>
+
+// Forward
+class Pool;
+class Variable;
+
+namespace parallel {
+
+using Time = double;
+using Variables = std::vector< Variable * >;
+
+// Observer advance worker pool: nullptr unless --threads > 1
+extern Pool * pool;
+
+// Advance Observers to Time t in Parallel
+void
+advance_observers( Variables const & observers, Time const t );
+
+} // parallel
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef QSS_Pool_hh_INCLUDED
+#define QSS_Pool_hh_INCLUDED
+
+// Worker Thread Pool
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Runs tasks 0..n-1 concurrently: Task i runs on worker i so a task can own per-worker state such as an FMU instance
+// Task 0 runs on the calling thread and run() returns when all tasks are done
+// Wake-up cost is a few microseconds per run() so this only pays off when each task has enough work
+
+// C++ Headers
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Worker Thread Pool
+class Pool
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Task = std::function< void( size_type ) >;
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Pool( size_type const n ) :
+	 n_( n )
+	{
+		assert( n_ >= 1u );
+		workers_.reserve( n_ - 1u );
+		for ( size_type i = 1; i < n_; ++i ) {
+			workers_.emplace_back( &Pool::work, this, i );
+		}
+	}
+
+	// Copy Constructor
+	Pool( Pool const & ) = delete;
+
+	// Destructor
+	~Pool()
+	{
+		{
+			std::lock_guard< std::mutex > lock( mutex_ );
+			stop_ = true;
+		}
+		start_.notify_all();
+		for ( auto & worker : workers_ ) worker.join();
+	}
+
+public: // Assignment
+
+	// Copy Assignment
+	Pool &
+	operator =( Pool const & ) = delete;
+
+public: // Properties
+
+	// Size
+	size_type
+	size() const
+	{
+		return n_;
+	}
+
+public: // Methods
+
+	// Run task( i ) for i in [0,n)
+	void
+	run( size_type const n, Task const & task )
+	{
+		assert( n <= n_ );
+		if ( n == 0u ) return;
+		{
+			std::lock_guard< std::mutex > lock( mutex_ );
+			task_ = &task;
+			n_run_ = n;
+			pending_ = n - 1u;
+			++generation_;
+		}
+		start_.notify_all();
+		task( 0u );
+		std::unique_lock< std::mutex > lock( mutex_ );
+		done_.wait( lock, [this]{ return pending_ == 0u; } );
+	}
+
+private: // Methods
+
+	// Worker Loop
+	void
+	work( size_type const i )
+	{
+		size_type generation( 0u );
+		std::unique_lock< std::mutex > lock( mutex_ );
+		while ( true ) {
+			start_.wait( lock, [&]{ return stop_ || ( generation_ != generation ); } );
+			if ( stop_ ) return;
+			generation = generation_;
+			if ( i >= n_run_ ) continue;
+			Task const & task( *task_ );
+			lock.unlock();
+			task( i );
+			lock.lock();
+			if ( --pending_ == 0u ) done_.notify_one();
+		}
+	}
+
+private: // Data
+
+	size_type n_{ 1u }; // Pool size (including calling thread)
+	std::vector< std::thread > workers_; // Worker threads
+	std::mutex mutex_;
+	std::condition_variable start_; // Signals a new run or stop
+	std::condition_variable done_; // Signals run completion
+	Task const * task_{ nullptr }; // Current task
+	size_type n_run_{ 0u }; // Tasks in current run
+	size_type pending_{ 0u }; // Worker tasks not yet done in current run
+	size_type generation_{ 0u }; // Run counter
+	bool stop_{ false }; // Shut down workers?
+
+};
+
+#endif
@@ -9,10 +9,16 @@
 // QSS Headers
 #include <QSS/ex_simulate.hh>
 #include <QSS/FMU_simulate.hh>
+#include <QSS/Model_File.hh>
 #include <QSS/options.hh>
+#include <QSS/Output_Binary.hh>
+#include <QSS/Output_Mapped.hh>
+#include <QSS/Output_Segments.hh>
+#include <QSS/Trace.hh>
 
 // C++ Headers
 #include <cstdlib>
+#include <exception>
 #include <iostream>
 
 // QSS Solver Main
@@ -22,13 +28,35 @@ main( int argc, char * argv[] )
 	// Process command line arguments
 	options::process_args( argc, argv );
 
+	// Convert text model file to binary, binary trace file to JSON, or binary, memory-mapped, or segments output file to text files
+	if ( ! options::convert.empty() ) {
+		std::string const & convert( options::convert );
+		if ( ( convert.length() >= 5 ) && ( convert.rfind( ".qsm" ) == convert.length() - 4u ) ) { // Text model
+			std::exit( model_text_to_binary( convert ) ? EXIT_SUCCESS : EXIT_FAILURE );
+		} else if ( ( convert.length() >= 6 ) && ( convert.rfind( ".qsst" ) == convert.length() - 5u ) ) { // Trace
+			std::exit( trace::trace_to_json( convert ) ? EXIT_SUCCESS : EXIT_FAILURE );
+		} else if ( ( convert.length() >= 5 ) && ( convert.rfind( ".seg" ) == convert.length() - 4u ) ) { // Segments
+			std::exit( output_segments_to_text( convert, options::dtOut ) ? EXIT_SUCCESS : EXIT_FAILURE );
+		} else if ( ( convert.length() >= 6 ) && ( convert.rfind( ".qssm" ) == convert.length() - 5u ) ) { // Memory-mapped
+			std::exit( output_mapped_to_text( convert ) ? EXIT_SUCCESS : EXIT_FAILURE );
+		} else { // Binary
+			std::exit( output_binary_to_text( convert ) ? EXIT_SUCCESS : EXIT_FAILURE );
+		}
+	}
+
 	// Run FMU or example model simulation
 	if ( options::model.empty() ) {
 		std::cerr << "No model name or FMU file specified" << std::endl;
 		std::exit( EXIT_FAILURE );
-	} else if ( ( options::model.length() >= 5 ) && ( options::model.rfind( ".fmu" ) == options::model.length() - 4u ) ) { // FMU
-		FMU::simulate();
-	} else { // Example
-		ex::simulate();
+	}
+	try {
+		if ( ( options::model.length() >= 5 ) && ( options::model.rfind( ".fmu" ) == options::model.length() - 4u ) ) { // FMU
+			FMU::simulate();
+		} else { // Example
+			ex::simulate();
+		}
+	} catch ( std::exception const & e ) {
+		std::cerr << "Error: " << e.what() << std::endl;
+		std::exit( EXIT_FAILURE );
 	}
 }
\ No newline at end of file
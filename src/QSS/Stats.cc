@@ -0,0 +1,100 @@
+// QSS Per-Variable Requantization Statistics
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Stats.hh>
+#include <QSS/Variable.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+// Step Size Histogram of All Variables
+Stats_Steps Variable_Stats::steps;
+
+#ifdef QSS_STATS
+
+// Report the Hottest Variables and Dependency Edges
+void
+stats_report( std::vector< Variable * > const & vars, std::size_t const n_top, std::ostream & stream )
+{
+	using size_type = std::size_t;
+	if ( n_top == 0u ) return;
+
+	// Totals
+	size_type n_requant( 0u ), n_simultaneous( 0u ), n_observer( 0u );
+	for ( Variable const * var : vars ) {
+		n_requant += var->stats.n_requant;
+		n_simultaneous += var->stats.n_simultaneous;
+		n_observer += var->stats.n_observer;
+	}
+	stream << "\nRequantization statistics: " << vars.size() << " variables: " << n_requant << " self requantizations (" << n_simultaneous << " simultaneous): " << n_observer << " observer advances\n";
+
+	// Step size histogram
+	stream << "\n Requantization step size tE - tQ histogram:\n";
+	Stats_Steps const & steps( Variable_Stats::steps );
+	for ( size_type b = 0; b < Stats_Steps::n_bins; ++b ) {
+		if ( steps.counts[ b ] == 0u ) continue;
+		stream << "  ";
+		if ( b == 0u ) {
+			stream << "< 1e" << Stats_Steps::decade_min;
+		} else if ( b == Stats_Steps::n_bins - 1u ) {
+			stream << "infinite";
+		} else if ( b == Stats_Steps::n_bins - 2u ) {
+			stream << ">= 1e" << Stats_Steps::decade_max;
+		} else {
+			int const decade( Stats_Steps::decade_min + int( b ) - 1 );
+			stream << "[1e" << decade << ",1e" << decade + 1 << ')';
+		}
+		stream << ": " << steps.counts[ b ] << '\n';
+	}
+
+	// Hottest variables
+	std::vector< Variable const * > hot( vars.begin(), vars.end() );
+	size_type const n_hot( std::min( n_top, hot.size() ) );
+	std::partial_sort( hot.begin(), hot.begin() + n_hot, hot.end(), []( Variable const * a, Variable const * b ){
+		return ( a->stats.n_requant > b->stats.n_requant ) || ( ( a->stats.n_requant == b->stats.n_requant ) && ( a->i_var < b->i_var ) );
+	} );
+	stream << "\n Top " << n_hot << " variables by self requantizations:\n";
+	stream << "  " << std::setw( 12 ) << "requants" << std::setw( 12 ) << "simultan" << std::setw( 12 ) << "observed" << std::setw( 12 ) << "fan-out" << std::setw( 13 ) << "mean step" << std::setw( 13 ) << "min step" << "  name\n";
+	for ( size_type i = 0; i < n_hot; ++i ) {
+		Variable const * var( hot[ i ] );
+		Variable_Stats const & s( var->stats );
+		stream << "  " << std::setw( 12 ) << s.n_requant << std::setw( 12 ) << s.n_simultaneous << std::setw( 12 ) << s.n_observer << std::setw( 12 ) << s.n_fanout;
+		stream << std::setprecision( 4 ) << std::setw( 13 ) << ( s.n_dt > 0u ? s.dt_sum / s.n_dt : 0.0 ) << std::setw( 13 ) << ( s.n_dt > 0u ? s.dt_min : 0.0 ) << std::setprecision( 6 );
+		stream << "  " << var->name << '\n';
+	}
+
+	// Hottest dependency edges: Each trigger requantization advances all its observers
+	struct Edge
+	{
+		Variable const * trigger;
+		Variable const * observer;
+	};
+	std::vector< Edge > edges;
+	for ( Variable const * var : vars ) {
+		if ( var->stats.n_requant == 0u ) continue;
+		for ( Variable const * observer : var->observers() ) edges.push_back( Edge{ var, observer } );
+	}
+	size_type const n_edges( std::min( n_top, edges.size() ) );
+	std::partial_sort( edges.begin(), edges.begin() + n_edges, edges.end(), []( Edge const & a, Edge const & b ){ // Ties favor edges into hot observers: Coupled hot pairs
+		if ( a.trigger->stats.n_requant != b.trigger->stats.n_requant ) return a.trigger->stats.n_requant > b.trigger->stats.n_requant;
+		if ( a.observer->stats.n_requant != b.observer->stats.n_requant ) return a.observer->stats.n_requant > b.observer->stats.n_requant;
+		return ( a.trigger->i_var < b.trigger->i_var ) || ( ( a.trigger->i_var == b.trigger->i_var ) && ( a.observer->i_var < b.observer->i_var ) );
+	} );
+	stream << "\n Top " << n_edges << " dependency edges by observer advances:\n";
+	stream << "  " << std::setw( 12 ) << "advances" << std::setw( 12 ) << "obs reqs" << "  trigger -> observer\n";
+	for ( size_type i = 0; i < n_edges; ++i ) {
+		Edge const & edge( edges[ i ] );
+		stream << "  " << std::setw( 12 ) << edge.trigger->stats.n_requant << std::setw( 12 ) << edge.observer->stats.n_requant << "  " << edge.trigger->name << " -> " << edge.observer->name << '\n';
+	}
+	stream << std::endl;
+}
+
+#endif
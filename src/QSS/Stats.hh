@@ -0,0 +1,95 @@
+#ifndef QSS_Stats_hh_INCLUDED
+#define QSS_Stats_hh_INCLUDED
+
+// QSS Per-Variable Requantization Statistics
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Counters are only compiled in when QSS_STATS is defined so the event loop pays nothing otherwise
+// Self requantizations, step sizes, and fan-out are recorded by the simulation loop after each trigger advance
+// Observer advances are recorded by Variable::advance_observers
+// The step size tE - tQ histogram is shared by all variables: Per-variable histograms would scale badly
+
+// C++ Headers
+#include <cmath>
+#include <cstddef>
+#include <iosfwd>
+#include <limits>
+#include <vector>
+
+// Forward
+class Variable;
+
+// Requantization Step Size Histogram
+struct Stats_Steps
+{
+	using size_type = std::size_t;
+
+	static int const decade_min = -9; // First decade bin is [1e-9,1e-8): Smaller steps go in the underflow bin
+	static int const decade_max = 3; // Last decade bin is [1e2,1e3): Larger finite steps go in the overflow bin
+	static size_type const n_decades = size_type( decade_max - decade_min );
+	static size_type const n_bins = n_decades + 3u; // Underflow, decades, overflow, and infinite
+
+	// Bin of a Step Size
+	static
+	size_type
+	bin( double const dt )
+	{
+		if ( dt == std::numeric_limits< double >::infinity() ) return n_bins - 1u;
+		if ( dt < std::pow( 10.0, decade_min ) ) return 0u;
+		int const decade( int( std::floor( std::log10( dt ) ) ) );
+		return ( decade >= decade_max ? n_bins - 2u : size_type( decade - decade_min ) + 1u );
+	}
+
+	size_type counts[ n_bins ] = {}; // Step counts per bin
+
+};
+
+// Per-Variable Requantization Statistics
+struct Variable_Stats
+{
+	using size_type = std::size_t;
+	using Time = double;
+
+	// Record a Self Requantization at tQ with Next Event at tE
+	void
+	requant(
+	 Time const tQ,
+	 Time const tE,
+	 bool const simultaneous,
+	 size_type const n_observers
+	)
+	{
+		++n_requant;
+		if ( simultaneous ) ++n_simultaneous;
+		n_fanout += n_observers;
+		Time const dt( tE - tQ );
+		if ( dt < std::numeric_limits< Time >::infinity() ) {
+			++n_dt;
+			dt_sum += dt;
+			if ( dt < dt_min ) dt_min = dt;
+		}
+		++steps.counts[ Stats_Steps::bin( dt ) ];
+	}
+
+	size_type n_requant{ 0u }; // Self requantizations
+	size_type n_simultaneous{ 0u }; // Self requantizations in simultaneous trigger events
+	size_type n_observer{ 0u }; // Observer advances: Driven by observee requantizations
+	size_type n_fanout{ 0u }; // Observer advances caused: Fan-out cost
+	size_type n_dt{ 0u }; // Finite requantization steps
+	Time dt_sum{ 0.0 }; // Finite requantization step sum
+	Time dt_min{ std::numeric_limits< Time >::infinity() }; // Finite requantization step min
+
+	static Stats_Steps steps; // Step size histogram of all variables
+
+};
+
+// Report the Hottest Variables and Dependency Edges
+void
+stats_report( std::vector< Variable * > const & vars, std::size_t const n_top, std::ostream & stream );
+
+#endif
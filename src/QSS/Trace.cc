@@ -0,0 +1,313 @@
+// QSS Solver Phase Timeline Tracing
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/Trace.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace trace {
+
+namespace { // Internal
+
+// File Magic Tag
+char const magic[ 4 ] = { 'Q', 'S', 'S', 'T' };
+
+// File Format Version
+std::uint32_t const version( 2u );
+
+// Phase Names
+char const * const phase_names[ n_phases ] = {
+ "queue_top",
+ "queue_shift",
+ "advance",
+ "advance0",
+ "advance1",
+ "advance2",
+ "advance3",
+ "observers",
+ "sample",
+ "output",
+ "fmu_set",
+ "fmu_get",
+ "fmu_time",
+ "fmu_derivatives",
+ "fmu_event_indicators",
+ "fmu_event"
+};
+
+// Duration Bits: Phase is in the high bits
+int const dur_bits( 48 );
+std::uint64_t const dur_mask( ( std::uint64_t( 1u ) << dur_bits ) - 1u ); // Longer durations are saturated
+
+// Trace Record
+struct Record
+{
+	std::uint64_t beg; // Begin time since trace start (ticks while tracing, ns in files)
+	std::uint64_t phase_dur; // Phase << 48 | Duration (ticks while tracing, ns in files)
+};
+
+static_assert( sizeof( Record ) == 16u, "Unexpected trace record size" );
+
+// Thread Ring Buffer
+struct Ring
+{
+	std::vector< Record > records; // Ring storage
+	std::uint64_t n{ 0u }; // Records recorded
+	std::uint32_t index{ 0u }; // Thread index in registration order
+};
+
+// Thread Records Oldest First
+struct Thread_Records
+{
+	std::uint32_t index{ 0u }; // Thread index
+	std::uint64_t n{ 0u }; // Records recorded
+	std::vector< Record > records; // Records kept
+};
+
+// Tracing State
+std::mutex mutex; // Registration lock
+std::vector< std::unique_ptr< Ring > > rings; // Thread ring buffers
+std::atomic< unsigned > generation( 0u ); // Tracing run generation: Invalidates thread-local ring pointers
+Clock::time_point t0; // Trace start time
+Ticks k0( 0u ); // Trace start ticks
+size_type capacity_mask( 0u ); // Ring capacity - 1
+std::string trace_file; // Trace file name
+
+// Thread-Local Ring Buffer Reference
+struct Local
+{
+	Ring * ring{ nullptr };
+	unsigned generation{ 0u };
+};
+thread_local Local local;
+
+// Register This Thread's Ring Buffer
+void
+register_thread()
+{
+	std::lock_guard< std::mutex > lock( mutex );
+	rings.emplace_back( new Ring );
+	Ring & ring( *rings.back() );
+	ring.records.resize( capacity_mask + 1u );
+	ring.index = std::uint32_t( rings.size() - 1u );
+	local.ring = &ring;
+	local.generation = generation.load( std::memory_order_relaxed );
+}
+
+// Has Suffix?
+bool
+has_suffix( std::string const & s, std::string const & suffix )
+{
+	return ( s.length() > suffix.length() ) && ( s.compare( s.length() - suffix.length(), suffix.length(), suffix ) == 0 );
+}
+
+// Write Chrome Trace JSON: Returns Whether Successful
+bool
+write_json( std::string const & file_name, std::vector< std::string > const & names, std::vector< Thread_Records > const & threads )
+{
+	std::ofstream stream( file_name, std::ios_base::binary | std::ios_base::out | std::ios_base::trunc );
+	if ( ! stream ) {
+		std::cerr << "Error: Trace file could not be opened: " << file_name << std::endl;
+		return false;
+	}
+	stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+	bool first( true );
+	char line[ 256 ];
+	for ( Thread_Records const & thread : threads ) {
+		std::snprintf( line, sizeof( line ), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s %u\"}}", first ? "" : ",\n", unsigned( thread.index ), thread.index == 0u ? "solver" : "worker", unsigned( thread.index ) );
+		stream << line;
+		first = false;
+		for ( Record const & record : thread.records ) {
+			std::size_t const p( std::size_t( record.phase_dur >> dur_bits ) );
+			std::uint64_t const beg( record.beg );
+			std::uint64_t const dur( record.phase_dur & dur_mask );
+			std::snprintf( line, sizeof( line ), ",\n{\"name\":\"%s\",\"cat\":\"qss\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%llu.%03u,\"dur\":%llu.%03u}", p < names.size() ? names[ p ].c_str() : "unknown", unsigned( thread.index ), static_cast< unsigned long long >( beg / 1000u ), unsigned( beg % 1000u ), static_cast< unsigned long long >( dur / 1000u ), unsigned( dur % 1000u ) );
+			stream << line;
+		}
+	}
+	stream << "\n]}\n";
+	if ( ! stream ) {
+		std::cerr << "Error: Trace file write failed: " << file_name << std::endl;
+		return false;
+	}
+	return true;
+}
+
+// Write Binary Trace: Returns Whether Successful
+bool
+write_binary( std::string const & file_name, std::vector< Thread_Records > const & threads )
+{
+	std::ofstream stream( file_name, std::ios_base::binary | std::ios_base::out | std::ios_base::trunc );
+	if ( ! stream ) {
+		std::cerr << "Error: Trace file could not be opened: " << file_name << std::endl;
+		return false;
+	}
+	std::uint32_t const header[ 3 ] = { version, std::uint32_t( n_phases ), std::uint32_t( threads.size() ) };
+	stream.write( magic, sizeof( magic ) );
+	stream.write( reinterpret_cast< char const * >( header ), sizeof( header ) );
+	for ( char const * phase_name : phase_names ) {
+		std::uint8_t const len( std::uint8_t( std::strlen( phase_name ) ) );
+		stream.write( reinterpret_cast< char const * >( &len ), sizeof( len ) );
+		stream.write( phase_name, len );
+	}
+	for ( Thread_Records const & thread : threads ) {
+		std::uint32_t const index[ 2 ] = { thread.index, 0u };
+		std::uint64_t const counts[ 2 ] = { thread.n, thread.records.size() };
+		stream.write( reinterpret_cast< char const * >( index ), sizeof( index ) );
+		stream.write( reinterpret_cast< char const * >( counts ), sizeof( counts ) );
+		stream.write( reinterpret_cast< char const * >( thread.records.data() ), thread.records.size() * sizeof( Record ) );
+	}
+	if ( ! stream ) {
+		std::cerr << "Error: Trace file write failed: " << file_name << std::endl;
+		return false;
+	}
+	return true;
+}
+
+} // Internal
+
+// Tracing On?
+std::atomic< bool > on( false );
+
+// Phase Name
+char const *
+name( Phase const phase )
+{
+	return phase_names[ std::size_t( phase ) ];
+}
+
+// Record a Phase Interval in This Thread's Ring Buffer
+void
+record( Phase const phase, Ticks const beg, Ticks const end )
+{
+	if ( ! on.load( std::memory_order_relaxed ) ) return; // Scope ended after tracing stopped
+	if ( ( local.ring == nullptr ) || ( local.generation != generation.load( std::memory_order_relaxed ) ) ) register_thread();
+	Ring & ring( *local.ring );
+	Record & rec( ring.records[ ring.n++ & capacity_mask ] );
+	rec.beg = beg - k0;
+	rec.phase_dur = ( std::uint64_t( phase ) << dur_bits ) | std::min( end - beg, dur_mask );
+}
+
+// Start Tracing: Each Thread Keeps the Last capacity Records (Rounded up to a Power of 2)
+void
+start( std::string const & file_name, size_type const capacity )
+{
+	std::lock_guard< std::mutex > lock( mutex );
+	size_type c( 1u );
+	while ( c < capacity ) c <<= 1;
+	capacity_mask = c - 1u;
+	rings.clear();
+	generation.fetch_add( 1u );
+	trace_file = file_name;
+	t0 = Clock::now();
+	k0 = ticks();
+	on.store( true );
+}
+
+// Stop Tracing and Write the Trace File: Returns Whether Successful
+bool
+stop()
+{
+	if ( ! on.load() ) return false;
+	on.store( false );
+	std::lock_guard< std::mutex > lock( mutex );
+
+	// Ticks to ns scaling
+	Ticks const k1( ticks() );
+	double const t_ns( double( std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - t0 ).count() ) );
+	double const ns_per_tick( k1 > k0 ? t_ns / double( k1 - k0 ) : 1.0 );
+
+	// Unroll rings oldest first with times converted to ns
+	std::vector< Thread_Records > threads;
+	std::uint64_t n_recorded( 0u ), n_kept( 0u );
+	for ( auto const & ring : rings ) {
+		Thread_Records thread;
+		thread.index = ring->index;
+		thread.n = ring->n;
+		std::uint64_t const capacity( capacity_mask + 1u );
+		std::uint64_t const n( std::min( ring->n, capacity ) );
+		thread.records.reserve( std::size_t( n ) );
+		for ( std::uint64_t i = ring->n - n; i < ring->n; ++i ) {
+			Record rec( ring->records[ std::size_t( i & capacity_mask ) ] );
+			rec.beg = std::uint64_t( double( rec.beg ) * ns_per_tick );
+			rec.phase_dur = ( rec.phase_dur & ~dur_mask ) | std::min( std::uint64_t( double( rec.phase_dur & dur_mask ) * ns_per_tick ), dur_mask );
+			thread.records.push_back( rec );
+		}
+		n_recorded += ring->n;
+		n_kept += n;
+		threads.push_back( std::move( thread ) );
+	}
+	rings.clear();
+	generation.fetch_add( 1u );
+
+	// Write
+	bool const ok( has_suffix( trace_file, ".json" ) ? write_json( trace_file, std::vector< std::string >( std::begin( phase_names ), std::end( phase_names ) ), threads ) : write_binary( trace_file, threads ) );
+	if ( ok ) {
+		std::cout << "Trace: " << n_kept << " phase records from " << threads.size() << " thread(s) written to " << trace_file << std::endl;
+		if ( n_kept < n_recorded ) std::cout << "Trace: " << n_recorded - n_kept << " oldest records overwritten in full ring buffers" << std::endl;
+	}
+	return ok;
+}
+
+// Convert a Binary Trace File to Chrome Trace JSON File name.json: Returns Whether Successful
+bool
+trace_to_json( std::string const & file_name )
+{
+	std::ifstream stream( file_name, std::ios_base::binary | std::ios_base::in );
+	if ( ! stream ) {
+		std::cerr << "Error: Trace file could not be opened: " << file_name << std::endl;
+		return false;
+	}
+	char tag[ 4 ];
+	std::uint32_t header[ 3 ];
+	if ( ! ( stream.read( tag, sizeof( tag ) ) && stream.read( reinterpret_cast< char * >( header ), sizeof( header ) ) ) || ( std::memcmp( tag, magic, sizeof( magic ) ) != 0 ) || ( header[ 0 ] != version ) ) {
+		std::cerr << "Error: Not a QSS binary trace file: " << file_name << std::endl;
+		return false;
+	}
+	std::vector< std::string > names;
+	for ( std::uint32_t p = 0; p < header[ 1 ]; ++p ) {
+		std::uint8_t len( 0u );
+		stream.read( reinterpret_cast< char * >( &len ), sizeof( len ) );
+		std::string phase_name( len, ' ' );
+		if ( len > 0u ) stream.read( &phase_name[ 0 ], len );
+		names.push_back( phase_name );
+	}
+	std::vector< Thread_Records > threads;
+	for ( std::uint32_t k = 0; k < header[ 2 ]; ++k ) {
+		std::uint32_t index[ 2 ];
+		std::uint64_t counts[ 2 ];
+		stream.read( reinterpret_cast< char * >( index ), sizeof( index ) );
+		stream.read( reinterpret_cast< char * >( counts ), sizeof( counts ) );
+		if ( ( ! stream ) || ( counts[ 1 ] > counts[ 0 ] ) || ( counts[ 1 ] > ( std::uint64_t( 1u ) << 40 ) ) ) break;
+		Thread_Records thread;
+		thread.index = index[ 0 ];
+		thread.n = counts[ 0 ];
+		thread.records.resize( std::size_t( counts[ 1 ] ) );
+		stream.read( reinterpret_cast< char * >( thread.records.data() ), thread.records.size() * sizeof( Record ) );
+		threads.push_back( std::move( thread ) );
+	}
+	if ( ( ! stream ) || ( threads.size() != header[ 2 ] ) ) {
+		std::cerr << "Error: Trace file is truncated or corrupt: " << file_name << std::endl;
+		return false;
+	}
+	std::string const base( has_suffix( file_name, ".qsst" ) ? file_name.substr( 0u, file_name.length() - 5u ) : file_name );
+	return write_json( base + ".json", names, threads );
+}
+
+} // trace
@@ -0,0 +1,140 @@
+#ifndef QSS_Trace_hh_INCLUDED
+#define QSS_Trace_hh_INCLUDED
+
+// QSS Solver Phase Timeline Tracing
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Phase scopes record begin time and duration into a per-thread ring buffer while tracing is on
+// When tracing is off a scope costs a flag test so the instrumentation can stay in the event loop
+// Per-event queue top and reschedule scopes are compiled in only with QSS_TRACE_QUEUE defined: They roughly triple the records
+// Ring buffers keep the most recent records of each thread: The oldest are overwritten when one fills
+// Traces are written at the end of the run as Chrome trace JSON (.json) viewable in Perfetto or chrome://tracing
+// or in a compact binary form (.qsst) that --convert turns into Chrome trace JSON
+// Binary form (native byte order):
+//  Header:  "QSST" u32 version, u32 phases, u32 threads
+//  Phases:  u8 name length, name characters
+//  Threads: u32 thread index, u32 0, u64 records recorded, u64 records kept, records oldest first
+//  Record:  u64 begin (ns since trace start), u64 phase << 48 | duration (ns)
+
+// C++ Headers
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#if defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+#include <intrin.h>
+#define QSS_TRACE_TSC
+#elif ( defined(__GNUC__) || defined(__clang__) ) && ( defined(__x86_64__) || defined(__i386__) )
+#include <x86intrin.h>
+#define QSS_TRACE_TSC
+#endif
+
+namespace trace {
+
+using size_type = std::size_t;
+using Clock = std::chrono::steady_clock;
+using Ticks = std::uint64_t;
+
+// Timestamp Counter Ticks: Converted to ns against the steady clock when tracing stops
+inline
+Ticks
+ticks()
+{
+#ifdef QSS_TRACE_TSC
+	return Ticks( __rdtsc() ); // About half the cost of a steady clock read
+#else
+	return Ticks( std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now().time_since_epoch() ).count() );
+#endif
+}
+
+// Solver Phases
+enum class Phase : std::uint16_t {
+ Queue_Top, // Simultaneous trigger lookups: Also event queue top with QSS_TRACE_QUEUE
+ Queue_Shift, // Event queue reschedules: With QSS_TRACE_QUEUE
+ Advance, // Single trigger advance: Includes its observer fan-out
+ Advance0, // Simultaneous trigger advance stages
+ Advance1,
+ Advance2,
+ Advance3,
+ Observers, // Observer fan-out of a requantization
+ Sample, // Sampled outputs
+ Output, // Requantization outputs
+ FMU_Set, // FMU variable value sets
+ FMU_Get, // FMU derivative gets
+ FMU_Time, // FMU time sets
+ FMU_Derivatives, // FMU derivative vector gets
+ FMU_Event_Indicators, // FMU event indicator gets
+ FMU_Event // FMU event processing after zero-crossings
+};
+size_type const n_phases( 16u );
+
+// Phase Name
+char const *
+name( Phase const phase );
+
+// Tracing On?
+extern std::atomic< bool > on;
+
+// Record a Phase Interval in This Thread's Ring Buffer
+void
+record( Phase const phase, Ticks const beg, Ticks const end );
+
+// Phase Timing Scope: Records its lifetime while tracing is on
+class Scope final
+{
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Scope( Phase const phase ) :
+	 phase_( phase ),
+	 on_( on.load( std::memory_order_relaxed ) )
+	{
+		if ( on_ ) beg_ = ticks();
+	}
+
+	// Copy Constructor
+	Scope( Scope const & ) = delete;
+
+	// Destructor
+	~Scope()
+	{
+		if ( on_ ) record( phase_, beg_, ticks() );
+	}
+
+public: // Assignment
+
+	// Copy Assignment
+	Scope &
+	operator =( Scope const & ) = delete;
+
+private: // Data
+
+	Phase phase_; // Phase
+	bool on_; // Tracing was on at scope entry?
+	Ticks beg_{ 0u }; // Begin ticks
+
+};
+
+// Start Tracing: Each Thread Keeps the Last capacity Records (Rounded up to a Power of 2)
+void
+start( std::string const & file_name, size_type const capacity = size_type( 1u ) << 20 );
+
+// Stop Tracing and Write the Trace File: Returns Whether Successful
+bool
+stop();
+
+// Convert a Binary Trace File to Chrome Trace JSON File name.json: Returns Whether Successful
+bool
+trace_to_json( std::string const & file_name );
+
+} // trace
+
+#endif
@@ -10,10 +10,17 @@
 // of the U.S. Department of Energy
 
 // QSS Headers
+#include <QSS/Counters.hh>
 #include <QSS/EventQueue.hh>
 #include <QSS/globals.hh>
 #include <QSS/math.hh>
+#include <QSS/Memory.hh>
 #include <QSS/options.hh>
+#include <QSS/Parallel.hh>
+#include <QSS/Trace.hh>
+#ifdef QSS_STATS
+#include <QSS/Stats.hh>
+#endif
 
 // C++ Headers
 #include <algorithm>
@@ -32,6 +39,7 @@ public: // Types
 	using Time = double;
 	using Value = double;
 	using Variables = std::vector< Variable * >;
+	using size_type = Variables::size_type;
 	using EventQ = EventQueue< Variable >;
 
 	struct AdvanceSpecs_LIQSS1
@@ -97,6 +105,14 @@ public: // Properties
 	int
 	order() const = 0;
 
+	// Zero-Crossing Variable?
+	virtual
+	bool
+	is_ZC() const
+	{
+		return false;
+	}
+
 	// Continuous Value at Time t
 	virtual
 	Value
@@ -128,6 +144,17 @@ public: // Properties
 		return 0.0;
 	}
 
+	// Continuous Representation Coefficients at tX: x( t ) = c[ 0 ] + c[ 1 ] d + c[ 2 ] d^2 + c[ 3 ] d^3 for d = t - tX
+	virtual
+	void
+	x_coefficients( Value * c ) const
+	{
+		c[ 0 ] = x( tX );
+		c[ 1 ] = x1( tX );
+		c[ 2 ] = one_half * x2( tX );
+		c[ 3 ] = one_sixth * x3( tX );
+	}
+
 	// Quantized Value at Time t
 	virtual
 	Value
@@ -158,6 +185,23 @@ public: // Properties
 		return 0.0;
 	}
 
+	// Quantized Representation Coefficients at tQ: q( t ) = c[ 0 ] + c[ 1 ] d + c[ 2 ] d^2 for d = t - tQ
+	virtual
+	void
+	q_coefficients( Value * c ) const
+	{
+		c[ 0 ] = q( tQ );
+		c[ 1 ] = q1( tQ );
+		c[ 2 ] = one_half * q2( tQ );
+	}
+
+	// Selected for Output?
+	bool
+	out() const
+	{
+		return i_out != std::numeric_limits< size_type >::max();
+	}
+
 	// Observers
 	Variables const &
 	observers() const
@@ -172,6 +216,15 @@ public: // Properties
 		return observers_;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	virtual
+	void
+	memory( Memory & m ) const
+	{
+		m.add( Memory::Names, Memory::heap( name ) );
+		m.add( Memory::Observers, Memory::heap( observers_ ) );
+	}
+
 	// Event Queue Iterator
 	EventQ::iterator &
 	event()
@@ -348,8 +401,16 @@ public: // Methods
 	void
 	advance_observers()
 	{
+		trace::Scope const scope( trace::Phase::Observers );
+		if ( ( parallel::pool != nullptr ) && ( observers_.size() >= options::par_fanout ) && ( ! options::output::d ) ) { // Large fan-out
+			parallel::advance_observers( observers_, tQ );
+			return;
+		}
 		for ( Variable * observer : observers_ ) {
 			observer->advance( tQ );
+#ifdef QSS_STATS
+			++observer->stats.n_observer;
+#endif
 		}
 	}
 
@@ -357,6 +418,7 @@ public: // Methods
 	void
 	advance_observers_2( Time const t )
 	{
+		trace::Scope const scope( trace::Phase::Observers );
 		for ( Variable * observer : observers_ ) {
 			observer->advance_2( t, tQ );
 		}
@@ -368,12 +430,33 @@ public: // Methods
 	advance( Time const )
 	{}
 
+	// Advance Observer Continuous Trajectory to Time t: Reads Only Observee Quantized Trajectories so Observers Can Advance Concurrently
+	virtual
+	void
+	advance_trajectory( Time const )
+	{}
+
+	// Set Observer End Time and Reschedule After a Trajectory Advance
+	virtual
+	void
+	advance_tE()
+	{}
+
 	// Advance Observer to Time t
 	virtual
 	void
 	advance_2( Time const, Time const )
 	{}
 
+#ifdef QSS_STATS
+	// Record Self Requantization Statistics: Call After Trigger Advance
+	void
+	stats_requant( bool const simultaneous = false )
+	{
+		stats.requant( tQ, tE, simultaneous, observers_.size() );
+	}
+#endif
+
 	// Set All Observee FMU Variable to Quantized Value at Time t
 	virtual
 	void
@@ -411,6 +494,11 @@ public: // Data
 	Time dt_min{ 0.0 }; // Time step min
 	Time dt_max{ infinity }; // Time step max
 	bool self_observer{ false }; // Variable appears in its derivative?
+	size_type i_var{ std::numeric_limits< size_type >::max() }; // Dense model variable index: Assigned at model build for per-variable arrays
+	size_type i_out{ std::numeric_limits< size_type >::max() }; // Output channel index: max => Not selected for output
+#ifdef QSS_STATS
+	Variable_Stats stats; // Requantization statistics
+#endif
 
 protected: // Data
 
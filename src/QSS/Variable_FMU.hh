@@ -12,7 +12,9 @@
 // QSS Headers
 #include <QSS/Variable.hh>
 #include <QSS/FMU.hh>
+#include <QSS/FMU_Pool.hh>
 #include <QSS/FMU_Variable.hh>
+#include <QSS/Trace.hh>
 
 // FMU-Based QSS Variable Abstract Base Class
 class Variable_FMU : public Variable
@@ -40,7 +42,8 @@ protected: // Creation
 	) :
 	 Variable( name, rTol, aTol, xIni ),
 	 var( var ),
-	 der( der )
+	 der( der ),
+	 fmu( FMU::fmu )
 	{}
 
 	// Copy Constructor
@@ -82,6 +85,15 @@ public: // Properties
 		return observees_;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Variable::memory( m );
+		m.add( Memory::Observers, Memory::heap( observees_ ) + Memory::heap( observer_groups_ ) );
+		for ( Variables_FMU const & group : observer_groups_ ) m.add( Memory::Observers, Memory::heap( group ) );
+	}
+
 public: // Methods
 
 	// Add Observee
@@ -105,10 +117,63 @@ public: // Methods
 		observees_.shrink_to_fit();
 	}
 
+	// Group Observers by FMU Instance for Parallel Observer Advance: Call After All Observers Added
+	void
+	group_observers()
+	{
+		observer_groups_.clear();
+		if ( ! FMU::pooled() ) return;
+		observer_groups_.resize( FMU::fmus.size() );
+		for ( Variable * observer : observers_ ) {
+			Variable_FMU * observer_fmu( static_cast< Variable_FMU * >( observer ) );
+			auto const i( std::find( FMU::fmus.begin(), FMU::fmus.end(), observer_fmu->fmu ) );
+			assert( i != FMU::fmus.end() );
+			observer_groups_[ i - FMU::fmus.begin() ].push_back( observer_fmu );
+		}
+		for ( auto & group : observer_groups_ ) group.shrink_to_fit();
+	}
+
+	// Advance non-Self Observers to New Time tQ: Observer Derivatives Fetched in Parallel by FMU Instance
+	void
+	advance_observers_fmu()
+	{
+		if ( FMU::pooled() ) {
+			Time const t( tQ );
+			FMU::pool->run( observer_groups_.size(), [this,t]( std::size_t const i ){
+				for ( Variable_FMU * observer : observer_groups_[ i ] ) {
+					if ( observer->tX < t ) { // Same condition as the observer advance
+						observer->fmu_set_observees_q( t );
+						observer->fmu_fetch_der();
+					}
+				}
+			} );
+		}
+		advance_observers();
+	}
+
+	// Advance non-Self Observers to Time t: Stage 2: Observer Derivatives Fetched in Parallel by FMU Instance
+	void
+	advance_observers_2_fmu( Time const t )
+	{
+		if ( FMU::pooled() ) {
+			Time const t_check( tQ );
+			FMU::pool->run( observer_groups_.size(), [this,t,t_check]( std::size_t const i ){
+				for ( Variable_FMU * observer : observer_groups_[ i ] ) {
+					if ( ( observer->order() >= 2 ) && ( observer->tX < t_check ) ) { // Same condition as the observer stage 2 advance
+						observer->fmu_set_observees_qn( t );
+						observer->fmu_fetch_der();
+					}
+				}
+			} );
+		}
+		advance_observers_2( t );
+	}
+
 	// Set All Observer's Observee FMU Variables to Quantized Value at Time t
 	void
 	fmu_set_observers_observees_q( Time const t ) const
 	{
+		if ( FMU::pooled() ) return; // Set in each observer's FMU instance by advance_observers_fmu
 		for ( Variable const * observer : observers_ ) {
 			observer->fmu_set_observees_q_tX( t ); //Do Elim virtual call
 		}
@@ -118,6 +183,7 @@ public: // Methods
 	void
 	fmu_set_observers_observees_qn( Time const t, Time const t_check ) const
 	{
+		if ( FMU::pooled() ) return; // Set in each observer's FMU instance by advance_observers_2_fmu
 		for ( Variable const * observer : observers_ ) {
 			observer->fmu_set_observees_qn_tX( t, t_check ); //Do Elim virtual call
 		}
@@ -128,7 +194,7 @@ public: // Methods
 	fmu_set_x( Time const t ) const
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
-		FMU::set_real( var.ref, x( t ) );
+		FMU::set_real( fmu, var.ref, x( t ) );
 	}
 
 	// Set FMU Variable to Quantized Value at Time t
@@ -136,14 +202,51 @@ public: // Methods
 	fmu_set_q( Time const t ) const
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
-		FMU::set_real( var.ref, q( t ) );
+		FMU::set_real( fmu, var.ref, q( t ) );
+	}
+
+	// Set FMU Variable in an FMU Instance to Quantized Value at Time t
+	void
+	fmu_set_q( Time const t, fmi2_import_t * const inst ) const
+	{
+		assert( ( tX <= t ) && ( t <= tE ) );
+		FMU::set_real( inst, var.ref, q( t ) );
 	}
 
 	// Set FMU Variable to Quantized Numeric Differentiation Value at Time t
 	void
 	fmu_set_qn( Time const t ) const
 	{
-		FMU::set_real( var.ref, qn( t ) );
+		FMU::set_real( fmu, var.ref, qn( t ) );
+	}
+
+	// Set FMU Variable in an FMU Instance to Quantized Numeric Differentiation Value at Time t
+	void
+	fmu_set_qn( Time const t, fmi2_import_t * const inst ) const
+	{
+		FMU::set_real( inst, var.ref, qn( t ) );
+	}
+
+	// Derivative from the FMU Instance: Uses the Value Fetched by a Parallel Observer Advance if Present
+	Value
+	fmu_get_der()
+	{
+		if ( der_fetched_ ) {
+			der_fetched_ = false;
+			return der_val_;
+		} else {
+			trace::Scope const scope( trace::Phase::FMU_Get );
+			return FMU::get_real( fmu, der.ref );
+		}
+	}
+
+	// Fetch Derivative from the FMU Instance for the Next fmu_get_der Call
+	void
+	fmu_fetch_der()
+	{
+		trace::Scope const scope( trace::Phase::FMU_Get );
+		der_val_ = FMU::get_real( fmu, der.ref );
+		der_fetched_ = true;
 	}
 
 	// Set All Observee FMU Variables to Quantized Value at Time t
@@ -151,9 +254,10 @@ public: // Methods
 	fmu_set_observees_q( Time const t ) const
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
+		trace::Scope const scope( trace::Phase::FMU_Set );
 		fmu_set_q( t ); // Set self state also
 		for ( auto observee : observees_ ) {
-			observee->fmu_set_q( t );
+			observee->fmu_set_q( t, fmu );
 		}
 	}
 
@@ -161,9 +265,10 @@ public: // Methods
 	void
 	fmu_set_observees_qn( Time const t ) const
 	{
+		trace::Scope const scope( trace::Phase::FMU_Set );
 		fmu_set_qn( t ); // Set self state also
 		for ( auto observee : observees_ ) {
-			observee->fmu_set_qn( t );
+			observee->fmu_set_qn( t, fmu );
 		}
 	}
 
@@ -172,10 +277,11 @@ public: // Methods
 	fmu_set_observees_q_tX( Time const t ) const
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
+		trace::Scope const scope( trace::Phase::FMU_Set );
 		if ( tX < t ) {
 			fmu_set_q( t ); // Set self state also
 			for ( auto observee : observees_ ) {
-				observee->fmu_set_q( t );
+				observee->fmu_set_q( t, fmu );
 			}
 		}
 	}
@@ -184,10 +290,11 @@ public: // Methods
 	void
 	fmu_set_observees_qn_tX( Time const t, Time const t_check ) const
 	{
+		trace::Scope const scope( trace::Phase::FMU_Set );
 		if ( tX < t_check ) {
 			fmu_set_qn( t ); // Set self state also
 			for ( auto observee : observees_ ) {
-				observee->fmu_set_qn( t );
+				observee->fmu_set_qn( t, fmu );
 			}
 		}
 	}
@@ -196,10 +303,14 @@ public: // Data
 
 	FMU_Variable var;
 	FMU_Variable der;
+	fmi2_import_t * fmu{ nullptr }; // FMU instance this variable's derivative is evaluated in
 
 protected: // Data
 
 	Variables_FMU observees_; // Variables this one dependent on
+	std::vector< Variables_FMU > observer_groups_; // Observers grouped by FMU instance index: Empty unless multiple FMU instances
+	Value der_val_{ 0.0 }; // Derivative fetched by a parallel observer advance
+	bool der_fetched_{ false }; // Derivative fetched and not yet used?
 
 };
 
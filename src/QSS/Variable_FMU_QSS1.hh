@@ -49,6 +49,14 @@ public: // Properties
 		return 1;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Variable_FMU::memory( m );
+		m.add( Memory::Variables, Memory::block( sizeof( *this ) ) );
+	}
+
 	// Continuous Value at Time t
 	Value
 	x( Time const t ) const
@@ -122,7 +130,7 @@ public: // Methods
 	void
 	init1_fmu()
 	{
-		x_1_ = FMU::get_real( der.ref );
+		x_1_ = fmu_get_der();
 	}
 
 	// Initialize Event in Queue
@@ -155,12 +163,12 @@ public: // Methods
 		fmu_set_observers_observees_q( tE );
 		if ( self_observer ) {
 			tX = tE;
-			x_1_ = FMU::get_real( der.ref );
+			x_1_ = fmu_get_der();
 		}
 		set_tE_aligned();
 		event( events.shift( tE, event() ) );
 		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
-		advance_observers();
+		advance_observers_fmu();
 	}
 
 	// Advance Simultaneous Trigger to Time tE and Requantize: Step 0
@@ -184,7 +192,7 @@ public: // Methods
 	advance1()
 	{
 		tX = tE;
-		x_1_ = FMU::get_real( der.ref );
+		x_1_ = fmu_get_der();
 		set_tE_aligned();
 		event( events.shift( tE, event() ) );
 		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
@@ -197,7 +205,7 @@ public: // Methods
 		assert( ( tX <= t ) && ( t <= tE ) );
 		if ( tX < t ) { // Could observe multiple variables with simultaneous triggering
 			x_0_ = x_0_ + ( x_1_ * ( t - tX ) );
-			x_1_ = FMU::get_real( der.ref );
+			x_1_ = fmu_get_der();
 			tX = t;
 			set_tE_unaligned();
 			event( events.shift( tE, event() ) );
@@ -211,6 +219,7 @@ private: // Methods
 	void
 	set_tE_aligned()
 	{
+		counters::Scope const scope( counters::Root );
 		assert( tX <= tQ );
 		assert( dt_min <= dt_max );
 		tE = ( x_1_ != 0.0 ? tQ + ( qTol / std::abs( x_1_ ) ) : infinity );
@@ -222,6 +231,7 @@ private: // Methods
 	void
 	set_tE_unaligned()
 	{
+		counters::Scope const scope( counters::Root );
 		assert( tQ <= tX );
 		assert( dt_min <= dt_max );
 		tE =
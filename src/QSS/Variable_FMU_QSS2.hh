@@ -49,6 +49,14 @@ public: // Properties
 		return 2;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Variable_FMU::memory( m );
+		m.add( Memory::Variables, Memory::block( sizeof( *this ) ) );
+	}
+
 	// Continuous Value at Time t
 	Value
 	x( Time const t ) const
@@ -140,7 +148,7 @@ public: // Methods
 	void
 	init1_fmu()
 	{
-		x_1_ = q_1_ = FMU::get_real( der.ref ); //! This causes solution difference!!!!!!!!!!!!!!
+		x_1_ = q_1_ = fmu_get_der(); //! This causes solution difference!!!!!!!!!!!!!!
 	}
 
 	// Initialize Quadratic Coefficient
@@ -148,7 +156,7 @@ public: // Methods
 	init2()
 	{
 //		x_2_ = one_half * FMU::get_derivative2( der.ics ); //API When 2nd derivative is available (instead of ND code)
-		x_2_ = options::one_half_over_dtND * ( FMU::get_real( der.ref ) - x_1_ ); // Forward Euler
+		x_2_ = options::one_half_over_dtND * ( fmu_get_der() - x_1_ ); // Forward Euler
 	}
 
 	// Initialize Event in Queue
@@ -184,10 +192,10 @@ public: // Methods
 		fmu_set_observers_observees_q( tE );
 		if ( self_observer ) {
 			tX = tE;
-			x_1_ = q_1_ = FMU::get_real( der.ref );
+			x_1_ = q_1_ = fmu_get_der();
 //			x_2_ = one_half * FMU::get_derivative2( der.ics ); //API When 2nd derivative is available (instead of ND code)
 		}
-		advance_observers();
+		advance_observers_fmu();
 		Time const t( tE + options::dtND ); // Advance time to t + delta for numeric differentiation
 		FMU::set_time( t );
 		if ( self_observer ) {
@@ -195,12 +203,12 @@ public: // Methods
 		}
 		fmu_set_observers_observees_qn( t, tE );
 		if ( self_observer ) {
-			x_2_ = options::one_half_over_dtND * ( FMU::get_real( der.ref ) - x_1_ ); // Forward Euler
+			x_2_ = options::one_half_over_dtND * ( fmu_get_der() - x_1_ ); // Forward Euler
 		}
 		set_tE_aligned();
 		event( events.shift( tE, event() ) );
 		if ( options::output::d ) std::cout << "! " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
-		advance_observers_2( t );
+		advance_observers_2_fmu( t );
 	}
 
 	// Advance Simultaneous Trigger to Time tE and Requantize: Step 0
@@ -225,7 +233,7 @@ public: // Methods
 	advance1()
 	{
 		tX = tE;
-		x_1_ = q_1_ = FMU::get_real( der.ref );
+		x_1_ = q_1_ = fmu_get_der();
 	}
 
 	// Advance Simultaneous Trigger to Time tE and Requantize: Step 2.FMU
@@ -241,7 +249,7 @@ public: // Methods
 	advance2()
 	{
 //		x_2_ = one_half * FMU::get_derivative2( der.ics ); //API When 2nd derivative is available (instead of ND code)
-		x_2_ = options::one_half_over_dtND * ( FMU::get_real( der.ref ) - x_1_ ); // Forward Euler
+		x_2_ = options::one_half_over_dtND * ( fmu_get_der() - x_1_ ); // Forward Euler
 		set_tE_aligned();
 		event( events.shift( tE, event() ) );
 		if ( options::output::d ) std::cout << "= " << name << '(' << tQ << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
@@ -255,7 +263,7 @@ public: // Methods
 		if ( tX < t ) { // Could observe multiple variables with simultaneous triggering
 			Time const tDel( t - tX );
 			x_0_ = x_0_ + ( ( x_1_ + ( x_2_ * tDel ) ) * tDel );
-			x_1_ = FMU::get_real( der.ref );
+			x_1_ = fmu_get_der();
 //			x_2_ = one_half * FMU::get_derivative2( der.ics ); //API When 2nd derivative is available (instead of ND code)
 //			tX = t;
 //			set_tE_unaligned();
@@ -269,7 +277,7 @@ public: // Methods
 	advance_2( Time const t, Time const t_check )
 	{
 		if ( tX < t_check ) { // Could observe multiple variables with simultaneous triggering
-			x_2_ = options::one_half_over_dtND * ( FMU::get_real( der.ref ) - x_1_ ); // Forward Euler
+			x_2_ = options::one_half_over_dtND * ( fmu_get_der() - x_1_ ); // Forward Euler
 			tX = t;
 			set_tE_unaligned();
 			event( events.shift( tE, event() ) );
@@ -283,6 +291,7 @@ private: // Methods
 	void
 	set_tE_aligned()
 	{
+		counters::Scope const scope( counters::Root );
 		assert( tX <= tQ );
 		assert( dt_min <= dt_max );
 		tE = ( x_2_ != 0.0 ? tQ + std::sqrt( qTol / std::abs( x_2_ ) ) : infinity );
@@ -298,6 +307,7 @@ private: // Methods
 	void
 	set_tE_unaligned()
 	{
+		counters::Scope const scope( counters::Root );
 		assert( tQ <= tX );
 		assert( dt_min <= dt_max );
 		Value const d0( x_0_ - ( q_0_ + ( q_1_ * ( tX - tQ ) ) ) );
@@ -0,0 +1,185 @@
+#ifndef QSS_Variable_FMU_ZC_hh_INCLUDED
+#define QSS_Variable_FMU_ZC_hh_INCLUDED
+
+// FMU-Based Zero-Crossing Variable
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Tracks an FMU event indicator with a linear trajectory built from its value and a forward-difference slope
+// The predicted zero-crossing time of that trajectory is scheduled in the event queue
+// FMI 2.0 doesn't provide event indicator dependencies so indicators depend on all QSS state variables
+// Trajectories are set by FMU_ZC_Block, which evaluates all the event indicators together once per event
+
+// QSS Headers
+#include <QSS/Variable.hh>
+
+// FMU-Based Zero-Crossing Variable
+class Variable_FMU_ZC final : public Variable
+{
+
+public: // Types
+
+	using Time = Variable::Time;
+	using Value = Variable::Value;
+	using size_type = std::size_t;
+
+public: // Creation
+
+	// Constructor
+	explicit
+	Variable_FMU_ZC(
+	 std::string const & name,
+	 size_type const idx, // Event indicator index (1-based)
+	 Value const zTol = 1.0e-6 // Zero-crossing tolerance
+	) :
+	 Variable( name, 0.0, zTol ),
+	 idx( idx )
+	{
+		qTol = aTol;
+	}
+
+public: // Properties
+
+	// Order of Method
+	int
+	order() const
+	{
+		return 1;
+	}
+
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Variable::memory( m );
+		m.add( Memory::Variables, Memory::block( sizeof( *this ) ) );
+	}
+
+	// Zero-Crossing Variable?
+	bool
+	is_ZC() const
+	{
+		return true;
+	}
+
+	// Zero-Crossing Occurred at Last Trigger Advance?
+	bool
+	crossed() const
+	{
+		return crossed_;
+	}
+
+	// Continuous Value at Time t
+	Value
+	x( Time const t ) const
+	{
+		assert( ( tX <= t ) && ( t <= tE ) );
+		return x_0_ + ( x_1_ * ( t - tX ) );
+	}
+
+	// Continuous Numeric Differenentiation Value at Time t: Allow t Outside of [tX,tE]
+	Value
+	xn( Time const t ) const
+	{
+		return x_0_ + ( x_1_ * ( t - tX ) );
+	}
+
+	// Continuous First Derivative at Time t
+	Value
+	x1( Time const t ) const
+	{
+		assert( ( tX <= t ) && ( t <= tE ) );
+		return x_1_;
+	}
+
+	// Quantized Value at Time t: Zero-Crossing Variables Aren't Quantized
+	Value
+	q( Time const t ) const
+	{
+		assert( ( tQ <= t ) && ( t <= tE ) );
+		return x_0_ + ( x_1_ * ( t - tX ) );
+	}
+
+	// Quantized Numeric Differenentiation Value at Time t: Allow t Outside of [tQ,tE]
+	Value
+	qn( Time const t ) const
+	{
+		return x_0_ + ( x_1_ * ( t - tX ) );
+	}
+
+public: // Methods
+
+	// Set Trajectory from Event Indicator Value and Forward-Difference Slope at Time t
+	void
+	set_trajectory( Time const t, Value const x_0, Value const x_1 )
+	{
+		x_0_ = x_0;
+		x_1_ = x_1;
+		tQ = tX = t;
+		if ( sign_ == 0 ) sign_ = ( x_0_ != 0.0 ? signum( x_0_ ) : signum( x_1_ ) ); // Side not yet known
+	}
+
+	// Initialize Event in Queue
+	void
+	init_event()
+	{
+		set_tE();
+		event( events.add( tE, this ) );
+		if ( options::output::d ) std::cout << "! " << name << '(' << tX << ')' << " = " << x_0_ << "+" << x_1_ << "*t zero-crossing   tE=" << tE << '\n';
+	}
+
+	// Advance Trigger to Predicted Zero-Crossing Time tE: Trajectory Set at tE First
+	void
+	advance()
+	{
+		assert( tX == tE );
+		crossed_ = ( sign_ != 0 ) && ( ( signum( x_0_ ) == -sign_ ) || ( ( std::abs( x_0_ ) <= aTol ) && ( sign_ * x_1_ < 0.0 ) ) );
+		if ( crossed_ ) sign_ = -sign_;
+		set_tE();
+		event( events.shift( tE, event() ) );
+		if ( options::output::d ) std::cout << ( crossed_ ? "Z " : "z " ) << name << '(' << tX << ')' << " = " << x_0_ << "+" << x_1_ << "*t zero-crossing   tE=" << tE << '\n';
+	}
+
+	// Reschedule After a Trajectory Update
+	void
+	advance_observer()
+	{
+		set_tE();
+		event( events.shift( tE, event() ) );
+		if ( options::output::d ) std::cout << "  " << name << '(' << tX << ')' << " = " << x_0_ << "+" << x_1_ << "*t zero-crossing   tE=" << tE << '\n';
+	}
+
+private: // Methods
+
+	// Set End Time to Predicted Zero-Crossing Time
+	void
+	set_tE()
+	{
+		counters::Scope const scope( counters::Root );
+		if ( ( sign_ != 0 ) && ( signum( x_0_ ) == -sign_ ) && ( std::abs( x_0_ ) > aTol ) ) { // Crossed since last evaluation
+			tE = tX;
+		} else if ( sign_ * x_1_ < 0.0 ) { // Heading toward zero
+			tE = std::max( tX - ( x_0_ / x_1_ ), tX );
+		} else {
+			tE = infinity;
+		}
+		if ( dt_max != infinity ) tE = std::min( tE, tX + dt_max );
+	}
+
+public: // Data
+
+	size_type idx{ 0u }; // Event indicator index (1-based)
+
+private: // Data
+
+	Value x_0_{ 0.0 }, x_1_{ 0.0 }; // Continuous rep coefficients
+	int sign_{ 0 }; // Side of zero the event indicator is on: 0 until known
+	bool crossed_{ false }; // Zero-crossing occurred at last trigger advance?
+
+};
+
+#endif
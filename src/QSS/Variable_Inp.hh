@@ -76,6 +76,14 @@ public: // Properties
 		return f_;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Super::memory( m );
+		m.add( Memory::Functions, f_.heap_bytes() );
+	}
+
 protected: // Data
 
 	Function f_; // Value function
@@ -66,6 +66,14 @@ public: // Properties
 		return 1;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Super::memory( m );
+		m.add( Memory::Variables, Memory::block( sizeof( *this ) ) );
+	}
+
 	// Continuous Value at Time t
 	Value
 	x( Time const t ) const
@@ -66,6 +66,14 @@ public: // Properties
 		return 3;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Super::memory( m );
+		m.add( Memory::Variables, Memory::block( sizeof( *this ) ) );
+	}
+
 	// Continuous Value at Time t
 	Value
 	x( Time const t ) const
@@ -108,6 +116,16 @@ public: // Properties
 		return six * x_3_;
 	}
 
+	// Continuous Representation Coefficients at tX
+	void
+	x_coefficients( Value * c ) const
+	{
+		c[ 0 ] = x_0_;
+		c[ 1 ] = x_1_;
+		c[ 2 ] = x_2_;
+		c[ 3 ] = x_3_;
+	}
+
 	// Quantized Value at Time t
 	Value
 	q( Time const t ) const
@@ -73,6 +73,14 @@ public: // Properties
 		return 1;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Super::memory( m );
+		m.add( Memory::Variables, Memory::block( sizeof( *this ) ) );
+	}
+
 	// Continuous Value at Time t
 	Value
 	x( Time const t ) const
@@ -218,20 +226,36 @@ public: // Methods
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
 		if ( tX < t ) { // Could observe multiple variables with simultaneous triggering
-			x_0_ = x_0_ + ( x_1_ * ( t - tX ) );
-			x_1_ = d_.q( tX = t );
-			set_tE_unaligned();
-			event( events.shift( tE, event() ) );
+			advance_trajectory( t );
+			advance_tE();
 			if ( options::output::d ) std::cout << "  " << name << '(' << t << ')' << " = " << q_0_ << " quantized, " << x_0_ << "+" << x_1_ << "*t internal   tE=" << tE << '\n';
 		}
 	}
 
+	// Advance Observer Continuous Trajectory to Time t: End Time Not Updated
+	void
+	advance_trajectory( Time const t )
+	{
+		assert( ( tX < t ) && ( t <= tE ) );
+		x_0_ = x_0_ + ( x_1_ * ( t - tX ) );
+		x_1_ = d_.q( tX = t );
+	}
+
+	// Set Observer End Time and Reschedule After a Trajectory Advance
+	void
+	advance_tE()
+	{
+		set_tE_unaligned();
+		event( events.shift( tE, event() ) );
+	}
+
 private: // Methods
 
 	// Set End Time: Quantized and Continuous Aligned
 	void
 	set_tE_aligned()
 	{
+		counters::Scope const scope( counters::Root );
 		assert( tX <= tQ );
 		assert( dt_min <= dt_max );
 		tE = ( x_1_ != 0.0 ? tQ + ( qTol / std::abs( x_1_ ) ) : infinity );
@@ -243,6 +267,7 @@ private: // Methods
 	void
 	set_tE_unaligned()
 	{
+		counters::Scope const scope( counters::Root );
 		assert( tQ <= tX );
 		assert( dt_min <= dt_max );
 		tE =
@@ -78,6 +78,14 @@ public: // Properties
 		return d_;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Super::memory( m );
+		m.add( Memory::Functions, d_.heap_bytes() );
+	}
+
 protected: // Data
 
 	Derivative d_; // Derivative function
@@ -71,6 +71,14 @@ public: // Properties
 		return 2;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Super::memory( m );
+		m.add( Memory::Variables, Memory::block( sizeof( *this ) ) );
+	}
+
 	// Continuous Value at Time t
 	Value
 	x( Time const t ) const
@@ -234,22 +242,38 @@ public: // Methods
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
 		if ( tX < t ) { // Could observe multiple variables with simultaneous triggering
-			Time const tDel( t - tX );
-			x_0_ = x_0_ + ( ( x_1_ + ( x_2_ * tDel ) ) * tDel );
-			x_1_ = d_.qs( t );
-			x_2_ = one_half * d_.qf1( tX = t );
-			set_tE_unaligned();
-			event( events.shift( tE, event() ) );
+			advance_trajectory( t );
+			advance_tE();
 			if ( options::output::d ) std::cout << "  " << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2 internal   tE=" << tE << '\n';
 		}
 	}
 
+	// Advance Observer Continuous Trajectory to Time t: End Time Not Updated
+	void
+	advance_trajectory( Time const t )
+	{
+		assert( ( tX < t ) && ( t <= tE ) );
+		Time const tDel( t - tX );
+		x_0_ = x_0_ + ( ( x_1_ + ( x_2_ * tDel ) ) * tDel );
+		x_1_ = d_.qs( t );
+		x_2_ = one_half * d_.qf1( tX = t );
+	}
+
+	// Set Observer End Time and Reschedule After a Trajectory Advance
+	void
+	advance_tE()
+	{
+		set_tE_unaligned();
+		event( events.shift( tE, event() ) );
+	}
+
 private: // Methods
 
 	// Set End Time: Quantized and Continuous Aligned
 	void
 	set_tE_aligned()
 	{
+		counters::Scope const scope( counters::Root );
 		assert( tX <= tQ );
 		assert( dt_min <= dt_max );
 		tE = ( x_2_ != 0.0 ? tQ + std::sqrt( qTol / std::abs( x_2_ ) ) : infinity );
@@ -265,6 +289,7 @@ private: // Methods
 	void
 	set_tE_unaligned()
 	{
+		counters::Scope const scope( counters::Root );
 		assert( tQ <= tX );
 		assert( dt_min <= dt_max );
 		Value const d0( x_0_ - ( q_0_ + ( q_1_ * ( tX - tQ ) ) ) );
@@ -71,6 +71,14 @@ public: // Properties
 		return 3;
 	}
 
+	// Memory Footprint: Adds Heap Bytes by Subsystem
+	void
+	memory( Memory & m ) const
+	{
+		Super::memory( m );
+		m.add( Memory::Variables, Memory::block( sizeof( *this ) ) );
+	}
+
 	// Continuous Value at Time t
 	Value
 	x( Time const t ) const
@@ -113,6 +121,16 @@ public: // Properties
 		return six * x_3_;
 	}
 
+	// Continuous Representation Coefficients at tX
+	void
+	x_coefficients( Value * c ) const
+	{
+		c[ 0 ] = x_0_;
+		c[ 1 ] = x_1_;
+		c[ 2 ] = x_2_;
+		c[ 3 ] = x_3_;
+	}
+
 	// Quantized Value at Time t
 	Value
 	q( Time const t ) const
@@ -270,23 +288,39 @@ public: // Methods
 	{
 		assert( ( tX <= t ) && ( t <= tE ) );
 		if ( tX < t ) { // Could observe multiple variables with simultaneous triggering
-			Time const tDel( t - tX );
-			x_0_ = x_0_ + ( ( x_1_ + ( x_2_ + ( x_3_ * tDel ) ) * tDel ) * tDel );
-			x_1_ = d_.qs( t );
-			x_2_ = one_half * d_.qc1( t );
-			x_3_ = one_sixth * d_.qc2( tX = t );
-			set_tE_unaligned();
-			event( events.shift( tE, event() ) );
+			advance_trajectory( t );
+			advance_tE();
 			if ( options::output::d ) std::cout << "  " << name << '(' << t << ')' << " = " << q_0_ << "+" << q_1_ << "*t+" << q_2_ << "*t^2 quantized, " << x_0_ << "+" << x_1_ << "*t+" << x_2_ << "*t^2+" << x_3_ << "*t^3 internal   tE=" << tE << '\n';
 		}
 	}
 
+	// Advance Observer Continuous Trajectory to Time t: End Time Not Updated
+	void
+	advance_trajectory( Time const t )
+	{
+		assert( ( tX < t ) && ( t <= tE ) );
+		Time const tDel( t - tX );
+		x_0_ = x_0_ + ( ( x_1_ + ( x_2_ + ( x_3_ * tDel ) ) * tDel ) * tDel );
+		x_1_ = d_.qs( t );
+		x_2_ = one_half * d_.qc1( t );
+		x_3_ = one_sixth * d_.qc2( tX = t );
+	}
+
+	// Set Observer End Time and Reschedule After a Trajectory Advance
+	void
+	advance_tE()
+	{
+		set_tE_unaligned();
+		event( events.shift( tE, event() ) );
+	}
+
 private: // Methods
 
 	// Set End Time: Quantized and Continuous Aligned
 	void
 	set_tE_aligned()
 	{
+		counters::Scope const scope( counters::Root );
 		assert( tX <= tQ );
 		assert( dt_min <= dt_max );
 		tE = ( x_3_ != 0.0 ? tQ + std::cbrt( qTol / std::abs( x_3_ ) ) : infinity );
@@ -302,6 +336,7 @@ private: // Methods
 	void
 	set_tE_unaligned()
 	{
+		counters::Scope const scope( counters::Root );
 		assert( tQ <= tX );
 		assert( dt_min <= dt_max );
 		Time const tXQ( tX - tQ );
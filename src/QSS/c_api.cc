@@ -0,0 +1,109 @@
+// QSS Solver C API
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/c_api.h>
+#include <QSS/ex_simulate.hh>
+#include <QSS/FMU_simulate.hh>
+#include <QSS/options.hh>
+#include <QSS/Output_Memory.hh>
+
+// C++ Headers
+#include <exception>
+#include <iostream>
+#include <new>
+
+// Simulation Results
+struct qss_results
+{
+	Output_Memory memory; // In-memory results
+};
+
+// Run a Simulation: Arguments as for the QSS Command Line Including argv[ 0 ]: Returns Results or NULL on Help, Invalid Arguments, or Failure
+qss_results *
+qss_simulate( int argc, char * argv[] )
+{
+	options::reset(); // Options of any earlier call don't carry over
+	if ( options::parse_args( argc, argv ) != options::Args::Run ) return nullptr; // Help or invalid arguments
+	if ( options::model.empty() ) {
+		std::cerr << "No model name or FMU file specified" << std::endl;
+		return nullptr;
+	}
+	qss_results * results( new ( std::nothrow ) qss_results );
+	if ( results == nullptr ) return nullptr;
+	try {
+		std::string const & model( options::model );
+		if ( ( model.length() >= 5 ) && ( model.rfind( ".fmu" ) == model.length() - 4u ) ) { // FMU
+			FMU::simulate( &results->memory );
+		} else { // Example
+			ex::simulate( &results->memory );
+		}
+	} catch ( std::exception const & e ) {
+		std::cerr << "Error: Simulation failed: " << e.what() << std::endl;
+		delete results;
+		return nullptr;
+	}
+	results->memory.shrink();
+	return results;
+}
+
+// Number of Channels
+size_t
+qss_results_channels( qss_results const * results )
+{
+	return results->memory.size();
+}
+
+// Channel Variable Name
+char const *
+qss_results_name( qss_results const * results, size_t channel )
+{
+	return results->memory.name( channel ).c_str();
+}
+
+// Channel Output Kind: x, q, or f
+char
+qss_results_kind( qss_results const * results, size_t channel )
+{
+	return results->memory.kind( channel );
+}
+
+// Index of Channel with Given Variable Name and Kind: Number of Channels if Not Found
+size_t
+qss_results_find( qss_results const * results, char const * name, char kind )
+{
+	return results->memory.find( name, kind );
+}
+
+// Channel Records
+size_t
+qss_results_size( qss_results const * results, size_t channel )
+{
+	return results->memory.n_records( channel );
+}
+
+// Channel Times Array
+double const *
+qss_results_times( qss_results const * results, size_t channel )
+{
+	return results->memory.t( channel ).data();
+}
+
+// Channel Values Array
+double const *
+qss_results_values( qss_results const * results, size_t channel )
+{
+	return results->memory.v( channel ).data();
+}
+
+// Free Results
+void
+qss_results_free( qss_results * results )
+{
+	delete results;
+}
@@ -0,0 +1,69 @@
+#ifndef QSS_c_api_h_INCLUDED
+#define QSS_c_api_h_INCLUDED
+
+/* QSS Solver C API
+ *
+ * Project: QSS Solver
+ *
+ * Developed by Objexx Engineering, Inc. (http://objexx.com)
+ * under contract to the National Renewable Energy Laboratory
+ * of the U.S. Department of Energy
+ */
+
+/* Runs a simulation in-process with results kept in memory instead of output files
+ * Each results channel is one variable and output kind (x, q, or f) with contiguous time and value arrays
+ * Array pointers stay valid until the results are freed: Hosts can wrap them without copying (e.g., numpy.frombuffer)
+ * Options are reset to their defaults and then set from the command line style arguments on each call
+ */
+
+/* C Headers */
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Simulation Results Handle */
+typedef struct qss_results qss_results;
+
+/* Run a Simulation: Arguments as for the QSS Command Line Including argv[ 0 ]: Returns Results or NULL on Help, Invalid Arguments, or Failure */
+qss_results *
+qss_simulate( int argc, char * argv[] );
+
+/* Number of Channels */
+size_t
+qss_results_channels( qss_results const * results );
+
+/* Channel Variable Name */
+char const *
+qss_results_name( qss_results const * results, size_t channel );
+
+/* Channel Output Kind: x, q, or f */
+char
+qss_results_kind( qss_results const * results, size_t channel );
+
+/* Index of Channel with Given Variable Name and Kind: Number of Channels if Not Found */
+size_t
+qss_results_find( qss_results const * results, char const * name, char kind );
+
+/* Channel Records */
+size_t
+qss_results_size( qss_results const * results, size_t channel );
+
+/* Channel Times Array */
+double const *
+qss_results_times( qss_results const * results, size_t channel );
+
+/* Channel Values Array */
+double const *
+qss_results_values( qss_results const * results, size_t channel );
+
+/* Free Results */
+void
+qss_results_free( qss_results * results );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
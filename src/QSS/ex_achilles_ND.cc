@@ -16,6 +16,9 @@
 #include <QSS/Variable_QSS2.hh>
 #include <QSS/Variable_QSS3.hh>
 
+// C++ Headers
+#include <stdexcept>
+
 namespace ex {
 
 using Variables = std::vector< Variable * >;
@@ -48,8 +51,7 @@ achilles_ND( Variables & vars )
 //		vars.push_back( x1 = new Variable_LIQSS2< Function_LTI_ND >( "x1", rTol, aTol, 0.0 ) );
 //		vars.push_back( x2 = new Variable_LIQSS2< Function_LTI_ND >( "x2", rTol, aTol, 2.0 ) );
 	} else {
-		std::cerr << "Unsupported QSS method" << std::endl;
-		std::exit( EXIT_FAILURE );
+		throw std::runtime_error( "Unsupported QSS method" );
 	}
 
 	// Derivatives
@@ -16,6 +16,9 @@
 #include <QSS/Variable_QSS2.hh>
 #include <QSS/Variable_QSS3.hh>
 
+// C++ Headers
+#include <stdexcept>
+
 namespace ex {
 
 using Variables = std::vector< Variable * >;
@@ -42,8 +45,7 @@ exponential_decay( Variables & vars )
 	} else if ( qss == QSS::LIQSS2 ) {
 		vars.push_back( x = new Variable_LIQSS2< Function_LTI >( "x", rTol, aTol, 1.0 ) );
 	} else {
-		std::cerr << "Unsupported QSS method" << std::endl;
-		std::exit( EXIT_FAILURE );
+		throw std::runtime_error( "Unsupported QSS method" );
 	}
 
 	// Derivatives
@@ -19,6 +19,7 @@
 // C++ Headers
 #include <cstddef>
 #include <fstream>
+#include <stdexcept>
 
 namespace ex {
 
@@ -48,8 +49,7 @@ nonlinear_ND( Variables & vars )
 	} else if ( qss == QSS::LIQSS2 ) {
 		vars.push_back( y = new Variable_LIQSS2< Function_nonlinear_ND >( "y", rTol, aTol, 2.0 ) );
 	} else {
-		std::cerr << "Unsupported QSS method" << std::endl;
-		std::exit( EXIT_FAILURE );
+		throw std::runtime_error( "Unsupported QSS method" );
 	}
 
 	// Derivatives
@@ -7,6 +7,7 @@
 // of the U.S. Department of Energy
 
 // QSS Headers
+#include <QSS/Counters.hh>
 #include <QSS/ex_achilles.hh>
 #include <QSS/ex_achilles2.hh>
 #include <QSS/ex_achillesc.hh>
@@ -17,10 +18,25 @@
 #include <QSS/ex_nonlinear.hh>
 #include <QSS/ex_nonlinear_ND.hh>
 #include <QSS/ex_stiff.hh>
+#include <QSS/ex_synthetic.hh>
 #include <QSS/ex_xy.hh>
 #include <QSS/ex_xyz.hh>
 #include <QSS/globals.hh>
+#include <QSS/Memory.hh>
+#include <QSS/Model_File.hh>
 #include <QSS/options.hh>
+#include <QSS/Output.hh>
+#include <QSS/Output_Binary.hh>
+#include <QSS/Output_Filter.hh>
+#include <QSS/Output_Mapped.hh>
+#include <QSS/Output_Queue.hh>
+#include <QSS/Output_Sampler.hh>
+#include <QSS/Output_Segments.hh>
+#include <QSS/Output_Stream.hh>
+#include <QSS/Parallel.hh>
+#include <QSS/Pool.hh>
+#include <QSS/Stats.hh>
+#include <QSS/Trace.hh>
 #include <QSS/Variable.hh>
 
 // C++ Headers
@@ -30,26 +46,36 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
-#include <unordered_map>
+#include <memory>
 #include <vector>
 
 namespace ex {
 
 // Simulate an Example Model
 void
-simulate()
+simulate( Output_Sink * sink )
 {
 	// Types
 	using Variables = Variable::Variables;
 	using size_type = Variables::size_type;
 	using Time = Variable::Time;
-	using QSS_Vars = std::unordered_map< Variable *, size_type >; // Map from QSS variables to their indexes
 
 	// I/o setup
 	std::cout << std::setprecision( 16 );
 	std::cerr << std::setprecision( 16 );
-	std::vector< std::ofstream > x_streams; // Continuous output streams
-	std::vector< std::ofstream > q_streams; // Quantized output streams
+	std::unique_ptr< Output_Sink > file_sink; // Binary or memory-mapped output file
+	if ( sink == nullptr ) {
+		if ( options::output::b ) {
+			file_sink.reset( new Output_Binary_Writer( output_binary_name( options::model ), 256u, options::output::z ) );
+		} else if ( options::output::m ) {
+			file_sink.reset( new Output_Mapped_Writer( output_mapped_name( options::model ) ) );
+		}
+		sink = file_sink.get(); // nullptr => Text files
+	}
+	std::unique_ptr< Output_Stream_Writer > stream( options::stream.empty() ? nullptr : new Output_Stream_Writer( options::stream ) ); // Live output stream
+	Output x_out( 'x', sink, stream.get() ); // Continuous outputs
+	Output q_out( 'q', sink, stream.get() ); // Quantized outputs
+	std::unique_ptr< Output_Segments_Writer > segments( options::output::p ? new Output_Segments_Writer( output_segments_name( options::model ) ) : nullptr ); // Trajectory segments file
 
 	// Controls
 	int const QSS_order_max( 3 ); // Highest QSS order in use or 3 tOut handle all supported orders
@@ -61,41 +87,68 @@ simulate()
 	Time tOut( t0 + options::dtOut ); // Sampling time
 	size_type iOut( 1u ); // Output step index
 
+	// Output variable filter: Before setup so invalid patterns fail with no variables to free
+	Output_Filter const filter( output_filter() );
+
 	// Variables collection
 	Variables vars;
 
+	// Event queue: Cleared of any earlier run in the process
+	events.clear();
+
 	// Example setup
-	if ( options::model == "achilles" ) {
-		ex::achilles( vars );
-	} else if ( options::model== "achilles2" ) {
-		ex::achilles2( vars );
-	} else if ( options::model== "achillesc" ) {
-		ex::achillesc( vars );
-	} else if ( options::model== "achilles_ND" ) {
-		ex::achilles_ND( vars );
-	} else if ( options::model== "exponential_decay" ) {
-		ex::exponential_decay( vars );
-	} else if ( options::model== "exponential_decay_sine" ) {
-		ex::exponential_decay_sine( vars );
-	} else if ( options::model== "exponential_decay_sine_ND" ) {
-		ex::exponential_decay_sine_ND( vars );
-	} else if ( options::model== "nonlinear" ) {
-		ex::nonlinear( vars );
-	} else if ( options::model== "nonlinear_ND" ) {
-		ex::nonlinear_ND( vars );
-	} else if ( options::model== "stiff" ) {
-		ex::stiff( vars );
-	} else if ( options::model== "xy" ) {
-		ex::xy( vars );
-	} else if ( options::model== "xyz" ) {
-		ex::xyz( vars );
-	}
-
-	// Variable-index map setup
-	QSS_Vars qss_vars;
-	for ( size_type i = 0, e = vars.size(); i < e; ++i ) {
-		qss_vars[ vars[ i ] ] = i;
+	try {
+		if ( options::model == "achilles" ) {
+			ex::achilles( vars );
+		} else if ( options::model== "achilles2" ) {
+			ex::achilles2( vars );
+		} else if ( options::model== "achillesc" ) {
+			ex::achillesc( vars );
+		} else if ( options::model== "achilles_ND" ) {
+			ex::achilles_ND( vars );
+		} else if ( options::model== "exponential_decay" ) {
+			ex::exponential_decay( vars );
+		} else if ( options::model== "exponential_decay_sine" ) {
+			ex::exponential_decay_sine( vars );
+		} else if ( options::model== "exponential_decay_sine_ND" ) {
+			ex::exponential_decay_sine_ND( vars );
+		} else if ( options::model== "nonlinear" ) {
+			ex::nonlinear( vars );
+		} else if ( options::model== "nonlinear_ND" ) {
+			ex::nonlinear_ND( vars );
+		} else if ( options::model== "stiff" ) {
+			ex::stiff( vars );
+		} else if ( options::model== "xy" ) {
+			ex::xy( vars );
+		} else if ( options::model== "xyz" ) {
+			ex::xyz( vars );
+		} else if ( ex::is_synthetic( options::model ) ) {
+			ex::synthetic( options::model, vars );
+		} else if ( is_model_file( options::model ) ) {
+			load_model_file( options::model, vars );
+		}
+	} catch ( ... ) { // Setup failed
+		for ( auto & var : vars ) delete var;
+		throw;
+	}
+
+	// Dense variable indexes: Per-variable data is kept in arrays indexed by these instead of pointer-keyed maps
+	for ( size_type i = 0, n = vars.size(); i < n; ++i ) {
+		vars[ i ]->i_var = i;
+	}
+
+	// Output variable selection
+	Variables out_vars; // Variables selected for output
+	for ( auto var : vars ) {
+		if ( filter.selected( var->name ) ) {
+			var->i_out = out_vars.size();
+			out_vars.push_back( var );
+		}
 	}
+	size_type const n_out_vars( out_vars.size() );
+	if ( ! filter.all() ) std::cout << n_out_vars << " of " << vars.size() << " variables selected for output" << std::endl;
+	x_out.decimate( options::dtOutMin, options::dxOutMin );
+	q_out.decimate( options::dtOutMin, options::dxOutMin );
 
 	// Solver master logic
 	for ( auto var : vars ) {
@@ -120,120 +173,236 @@ simulate()
 	for ( auto var : vars ) {
 		var->init_event();
 	}
-	size_type n_vars( vars.size() );
+	std::unique_ptr< Output_Sampler > sampler( options::output::s && ( options::output::x || options::output::q ) ? new Output_Sampler( out_vars, options::output::x, options::output::q ) : nullptr ); // Sampled QSS outputs
+	auto segment_out = [&]( size_type const i ){ // Put output variable's current trajectory segment
+		Variable const * var( out_vars[ i ] );
+		Variable::Value c[ 4 ];
+		var->x_coefficients( c );
+		segments->put( i, var->tX, var->order(), c );
+	};
+	auto changed = [&]( size_type const i ){ // Output variable's trajectory changed
+		if ( sampler ) sampler->changed( i );
+		if ( segments ) segment_out( i );
+	};
+	auto changed_trigger = [&]( Variable * trigger ){ // Trigger and observer trajectories changed: Unselected variables are skipped
+		if ( trigger->out() ) changed( trigger->i_out );
+		for ( Variable * observer : trigger->observers() ) {
+			if ( observer->out() ) changed( observer->i_out );
+		}
+	};
 	bool const doSOut( options::output::s && ( options::output::x || options::output::q ) );
 	bool const doROut( options::output::r && ( options::output::x || options::output::q ) );
 	size_type n_requant_events( 0 );
+	size_type n_observer_advances( 0 );
 	if ( ( options::output::r || options::output::s ) && ( options::output::x || options::output::q ) ) { // t0 QSS outputs
-		for ( auto var : vars ) { // QSS outputs
+		for ( auto var : out_vars ) { // QSS outputs
 			if ( options::output::x ) {
-				x_streams.push_back( std::ofstream( var->name + ".x.out", std::ios_base::binary | std::ios_base::out ) );
-				x_streams.back() << std::setprecision( 16 ) << t << '\t' << var->x( t ) << '\n';
+				x_out.add( var->name );
+				x_out( x_out.size() - 1u, t, var->x( t ) );
 			}
 			if ( options::output::q ) {
-				q_streams.push_back( std::ofstream( var->name + ".q.out", std::ios_base::binary | std::ios_base::out ) );
-				q_streams.back() << std::setprecision( 16 ) << t << '\t' << var->q( t ) << '\n';
+				q_out.add( var->name );
+				q_out( q_out.size() - 1u, t, var->q( t ) );
 			}
 		}
 	}
+	if ( segments ) { // t0 trajectory segments
+		for ( size_type i = 0; i < n_out_vars; ++i ) {
+			segments->add( out_vars[ i ]->name );
+			segment_out( i );
+		}
+	}
+	std::unique_ptr< Output_Queue > queue( options::async != options::Async::None ? new Output_Queue( options::async_buffer, options::async == options::Async::Drop ) : nullptr ); // Asynchronous output
+	if ( queue ) { // Attach after t0 outputs so channels aren't added while the writer thread runs
+		x_out.queue( queue.get() );
+		q_out.queue( queue.get() );
+	}
+	std::unique_ptr< Pool > workers( options::threads > 1 ? new Pool( size_type( options::threads ) ) : nullptr ); // Parallel observer advances
+	parallel::pool = workers.get();
+	if ( parallel::pool != nullptr ) std::cout << options::threads << " threads for parallel observer advances: Fan-outs >= " << options::par_fanout << " observers and simultaneous batches >= " << options::par_batch << " triggers" << std::endl;
+	Variables batch_observers; // Observers of a simultaneous trigger batch
+	if ( ! options::trace.empty() ) trace::start( options::trace ); // Solver phase tracing
+#ifdef QSS_STATS
+	bool const counting( options::perf_counters && counters::start() ); // Performance counters by phase
+#endif
 	while ( t <= tE ) {
 		t = events.top_time();
 		if ( doSOut ) { // Sampled and/or FMU outputs
 			Time const tStop( std::min( t, tE ) );
 			while ( tOut < tStop ) {
-				for ( size_type i = 0; i < n_vars; ++i ) {
-					if ( options::output::x ) x_streams[ i ] << tOut << '\t' << vars[ i ]->x( tOut ) << '\n';
-					if ( options::output::q ) q_streams[ i ] << tOut << '\t' << vars[ i ]->q( tOut ) << '\n';
+				trace::Scope const scope( trace::Phase::Sample );
+				counters::Scope const counters_scope( counters::Output );
+				sampler->sample( tOut );
+				for ( size_type i = 0; i < n_out_vars; ++i ) {
+					if ( options::output::x ) x_out( i, tOut, sampler->x( i ) );
+					if ( options::output::q ) q_out( i, tOut, sampler->q( i ) );
 				}
 				assert( iOut < std::numeric_limits< size_type >::max() );
 				tOut = t0 + ( ++iOut ) * options::dtOut;
 			}
 		}
 		if ( t <= tE ) { // Perform event
+			counters::Scope const counters_scope( counters::Derivative ); // Exclusive of nested queue, root, and output phases
 			++n_requant_events;
 			if ( events.simultaneous() ) { // Simultaneous trigger
 				if ( options::output::d ) std::cout << "Simultaneous trigger event at t = " << t << std::endl;
 				EventQueue< Variable >::Variables triggers( events.simultaneous_variables() ); // Chg tOut generator approach tOut avoid heap hit // Sort/ptn by QSS order tOut save unnec loops/calls below
 				for ( Variable * trigger : triggers ) {
 					assert( trigger->tE == t );
+					trace::Scope const scope( trace::Phase::Advance0 );
 					trigger->advance0();
 				}
 				for ( Variable * trigger : triggers ) {
+					trace::Scope const scope( trace::Phase::Advance1 );
 					trigger->advance1_LIQSS();
 				}
 				for ( Variable * trigger : triggers ) {
+					trace::Scope const scope( trace::Phase::Advance1 );
 					trigger->advance1();
 				}
 				if ( QSS_order_max >= 2 ) {
 					for ( Variable * trigger : triggers ) {
+						trace::Scope const scope( trace::Phase::Advance2 );
 						trigger->advance2_LIQSS();
 					}
 					for ( Variable * trigger : triggers ) {
+						trace::Scope const scope( trace::Phase::Advance2 );
 						trigger->advance2();
 					}
 					if ( QSS_order_max >= 3 ) {
 						for ( Variable * trigger : triggers ) {
+							trace::Scope const scope( trace::Phase::Advance3 );
 							trigger->advance3();
 						}
 					}
 				}
+				if ( ( parallel::pool != nullptr ) && ( triggers.size() >= options::par_batch ) && ( ! options::output::d ) ) { // Large batch: Advance all the triggers' observers together
+					trace::Scope const scope( trace::Phase::Observers );
+					batch_observers.clear();
+					for ( Variable * trigger : triggers ) {
+						batch_observers.insert( batch_observers.end(), trigger->observers().begin(), trigger->observers().end() );
+					}
+					parallel::advance_observers( batch_observers, t );
+				} else {
+					for ( Variable * trigger : triggers ) {
+						trigger->advance_observers();
+					}
+				}
 				for ( Variable * trigger : triggers ) {
-					trigger->advance_observers();
+					n_observer_advances += trigger->observers().size();
+#ifdef QSS_STATS
+					trigger->stats_requant( true );
+#endif
 				}
 				if ( doROut ) { // Requantization output
+					trace::Scope const scope( trace::Phase::Output );
+					counters::Scope const counters_scope( counters::Output );
 					for ( Variable * trigger : triggers ) {
 						if ( options::output::a ) { // All variables output
-							for ( size_type i = 0; i < n_vars; ++i ) {
-								if ( options::output::x ) x_streams[ i ] << t << '\t' << vars[ i ]->x( t ) << '\n';
-								if ( options::output::q ) q_streams[ i ] << t << '\t' << vars[ i ]->q( t ) << '\n';
+							for ( size_type i = 0; i < n_out_vars; ++i ) {
+								if ( options::output::x ) x_out.requant( i, t, out_vars[ i ]->x( t ) );
+								if ( options::output::q ) q_out.requant( i, t, out_vars[ i ]->q( t ) );
 							}
-						} else { // Trigger variable output
-							size_type const i( qss_vars[ trigger ] );
-							if ( options::output::x ) x_streams[ i ] << t << '\t' << trigger->x( t ) << '\n';
-							if ( options::output::q ) q_streams[ i ] << t << '\t' << trigger->q( t ) << '\n';
+						} else if ( trigger->out() ) { // Trigger variable output
+							size_type const i( trigger->i_out );
+							if ( options::output::x ) x_out.requant( i, t, trigger->x( t ) );
+							if ( options::output::q ) q_out.requant( i, t, trigger->q( t ) );
 						}
 					}
 				}
+				if ( sampler || segments ) { // Sampled output and trajectory segments tracking
+					for ( Variable * trigger : triggers ) {
+						changed_trigger( trigger );
+					}
+				}
 			} else { // Single trigger
 				Variable * trigger( events.top() );
 				assert( trigger->tE == t );
-				trigger->advance();
+				{
+					trace::Scope const scope( trace::Phase::Advance );
+					trigger->advance();
+				}
+				n_observer_advances += trigger->observers().size();
+#ifdef QSS_STATS
+				trigger->stats_requant();
+#endif
 				if ( doROut ) { // Requantization output
+					trace::Scope const scope( trace::Phase::Output );
+					counters::Scope const counters_scope( counters::Output );
 					if ( options::output::a ) { // All variables output
-						for ( size_type i = 0; i < n_vars; ++i ) {
-							if ( options::output::x ) x_streams[ i ] << t << '\t' << vars[ i ]->x( t ) << '\n';
-							if ( options::output::q ) q_streams[ i ] << t << '\t' << vars[ i ]->q( t ) << '\n';
+						for ( size_type i = 0; i < n_out_vars; ++i ) {
+							if ( options::output::x ) x_out.requant( i, t, out_vars[ i ]->x( t ) );
+							if ( options::output::q ) q_out.requant( i, t, out_vars[ i ]->q( t ) );
 						}
-					} else { // Trigger variable output
-						size_type const i( qss_vars[ trigger ] );
-						if ( options::output::x ) x_streams[ i ] << t << '\t' << trigger->x( t ) << '\n';
-						if ( options::output::q ) q_streams[ i ] << t << '\t' << trigger->q( t ) << '\n';
+					} else if ( trigger->out() ) { // Trigger variable output
+						size_type const i( trigger->i_out );
+						if ( options::output::x ) x_out.requant( i, t, trigger->x( t ) );
+						if ( options::output::q ) q_out.requant( i, t, trigger->q( t ) );
 					}
 				}
+				if ( sampler || segments ) changed_trigger( trigger ); // Sampled output and trajectory segments tracking
 			}
 		}
 	}
+	parallel::pool = nullptr;
+	if ( trace::on ) trace::stop();
+#ifdef QSS_STATS
+	counters::Counts const counts( counting ? counters::stop() : counters::Counts() );
+#endif
+
+	// Memory footprint before outputs close
+	Memory memory;
+	memory.n_variables = vars.size();
+	for ( auto var : vars ) {
+		var->memory( memory );
+		memory.n_edges += var->observers().size();
+	}
+	memory.add( Memory::Variables, Memory::heap( vars ) + Memory::heap( out_vars ) );
+	memory.add( Memory::Event_Queue, events.heap_bytes() );
+	memory.add( Memory::Outputs, x_out.heap_bytes() + q_out.heap_bytes() + ( sink != nullptr ? sink->heap_bytes() : 0u ) + ( stream ? stream->heap_bytes() : 0u ) + ( queue ? queue->heap_bytes() : 0u ) + ( sampler ? sampler->heap_bytes() : 0u ) + ( segments ? segments->heap_bytes() : 0u ) );
+
+	if ( segments ) segments->close( tE );
 
 	// tE QSS outputs and streams close
 	if ( ( options::output::r || options::output::s ) && ( options::output::x || options::output::q ) ) {
-		for ( size_type i = 0; i < n_vars; ++i ) {
-			Variable const * var( vars[ i ] );
+		for ( size_type i = 0; i < n_out_vars; ++i ) {
+			Variable const * var( out_vars[ i ] );
 			if ( var->tQ < tE ) {
 				if ( options::output::x ) {
-					x_streams[ i ] << tE << '\t' << var->x( tE ) << '\n';
-					x_streams[ i ].close();
+					x_out( i, tE, var->x( tE ) );
+					x_out.close( i );
 				}
 				if ( options::output::q ) {
-					q_streams[ i ] << tE << '\t' << var->q( tE ) << '\n';
-					q_streams[ i ].close();
+					q_out( i, tE, var->q( tE ) );
+					q_out.close( i );
 				}
 			}
 		}
 	}
 
+	// Asynchronous output completion
+	if ( queue ) {
+		queue->stop();
+		if ( queue->n_blocked() > 0u ) std::cout << "Output queue full " << queue->n_blocked() << " times: Solver waited for writer" << std::endl;
+		if ( queue->n_dropped() > 0u ) std::cerr << "Warning: Output queue full: " << queue->n_dropped() << " requantization output records dropped: Sampled outputs are complete" << std::endl;
+	}
+
+	// Live output stream completion
+	if ( stream ) {
+		stream->close();
+		if ( stream->n_dropped() > 0u ) std::cout << "Output stream: " << stream->n_dropped() << " records dropped while no monitor was connected or it lagged" << std::endl;
+	}
+
 	// Reporting
 	std::cout << "Simulation complete" << std::endl;
 	std::cout << n_requant_events << " total requantization events occurred" << std::endl;
+	std::cout << n_observer_advances << " total observer advances occurred" << std::endl;
+	memory_summary( memory, std::cout );
+	if ( options::memory ) memory_report( memory, std::cout );
+#ifdef QSS_STATS
+	stats_report( vars, options::stats, std::cout );
+	if ( counting ) counters::report( counts, std::cout );
+#endif
 
 	// QSS cleanup
 	for ( auto & var : vars ) delete var;
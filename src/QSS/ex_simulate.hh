@@ -9,11 +9,14 @@
 // under contract to the National Renewable Energy Laboratory
 // of the U.S. Department of Energy
 
+// QSS Headers
+#include <QSS/Output_Sink.hh>
+
 namespace ex {
 
 // Simulate an Example Model
 void
-simulate();
+simulate( Output_Sink * sink = nullptr ); // Results sink: nullptr => Output files
 
 } // ex
 
@@ -0,0 +1,296 @@
+// Synthetic Scalable LTI Model Setup
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// QSS Headers
+#include <QSS/ex_synthetic.hh>
+#include <QSS/options.hh>
+#include <QSS/Function_LTI.hh>
+#include <QSS/Variable_LIQSS1.hh>
+#include <QSS/Variable_LIQSS2.hh>
+#include <QSS/Variable_QSS1.hh>
+#include <QSS/Variable_QSS2.hh>
+#include <QSS/Variable_QSS3.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace ex {
+
+using Variables = std::vector< Variable * >;
+
+namespace { // Internal
+
+using size_type = std::size_t;
+using V = Variable_QSS< Function_LTI >;
+
+// Synthetic Model Kinds and Their Dimension Counts
+struct Kind
+{
+	char const * name;
+	size_type n_dims;
+};
+Kind const kinds[] = { { "chain", 1u }, { "grid2d", 2u }, { "grid3d", 3u }, { "graph", 1u }, { "blocks", 2u }, { "sync", 2u } };
+
+// Synthetic Model Spec
+struct Spec
+{
+	std::string kind; // Model kind
+	std::vector< size_type > dims; // Dimensions
+	double coupling{ 1.0 }; // Coupling strength
+	double stiffness{ 1.0 }; // Decay rate spread ratio
+	size_type fanout{ 4u }; // Graph dependencies per variable
+	unsigned long seed{ 1ul }; // Graph random seed
+};
+
+// Invalid Spec Error
+void
+invalid( std::string const & model, std::string const & msg )
+{
+	throw std::runtime_error( "Invalid synthetic model spec: " + model + ": " + msg );
+}
+
+// Parse a Positive Integer: 0 if Invalid
+size_type
+count_of( std::string const & s )
+{
+	if ( s.empty() || ( s.find_first_not_of( "0123456789" ) != std::string::npos ) || ( s.length() > 9u ) ) return 0u;
+	return size_type( std::stoul( s ) );
+}
+
+// Parse a Spec
+Spec
+spec_of( std::string const & model )
+{
+	Spec spec;
+	std::string::size_type const colon( model.find( ':' ) );
+	spec.kind = model.substr( 0u, colon );
+	std::string::size_type const comma( model.find( ',', colon ) );
+	std::string const dims( model.substr( colon + 1u, comma == std::string::npos ? std::string::npos : comma - colon - 1u ) );
+
+	// Dimensions
+	std::istringstream dims_stream( dims );
+	std::string dim;
+	while ( std::getline( dims_stream, dim, 'x' ) ) {
+		size_type const n( count_of( dim ) );
+		if ( n == 0u ) invalid( model, "Dimensions must be positive integers" );
+		spec.dims.push_back( n );
+	}
+	for ( Kind const & kind : kinds ) {
+		if ( ( spec.kind == kind.name ) && ( spec.dims.size() != kind.n_dims ) ) invalid( model, spec.kind + " needs " + std::to_string( kind.n_dims ) + " dimension(s)" );
+	}
+	double size( 1.0 );
+	for ( size_type const n : spec.dims ) size *= double( n );
+	if ( size > 1.0e8 ) invalid( model, "More than 1e8 variables" );
+	if ( spec.kind == "blocks" ) spec.coupling = 0.01;
+
+	// Key=value parameters
+	if ( comma != std::string::npos ) {
+		std::istringstream keys_stream( model.substr( comma + 1u ) );
+		std::string key_value;
+		while ( std::getline( keys_stream, key_value, ',' ) ) {
+			std::string::size_type const eq( key_value.find( '=' ) );
+			if ( eq == std::string::npos ) invalid( model, "Parameter is not key=value: " + key_value );
+			std::string const key( key_value.substr( 0u, eq ) );
+			std::string const value( key_value.substr( eq + 1u ) );
+			char * end( nullptr );
+			double const d( std::strtod( value.c_str(), &end ) );
+			bool const numeric( ( ! value.empty() ) && ( *end == '\0' ) );
+			if ( key == "coupling" ) {
+				if ( ! ( numeric && ( d >= 0.0 ) ) ) invalid( model, "coupling must be a nonnegative number" );
+				spec.coupling = d;
+			} else if ( key == "stiffness" ) {
+				if ( ! ( numeric && ( d >= 1.0 ) ) ) invalid( model, "stiffness must be a number >= 1" );
+				spec.stiffness = d;
+			} else if ( key == "fanout" ) {
+				spec.fanout = count_of( value );
+				if ( spec.fanout == 0u ) invalid( model, "fanout must be a positive integer" );
+			} else if ( key == "seed" ) {
+				if ( value.empty() || ( value.find_first_not_of( "0123456789" ) != std::string::npos ) ) invalid( model, "seed must be a nonnegative integer" );
+				spec.seed = std::stoul( value );
+			} else {
+				invalid( model, "Unknown parameter: " + key );
+			}
+		}
+	}
+	if ( ( spec.kind == "graph" ) && ( spec.fanout >= spec.dims[ 0 ] ) ) invalid( model, "fanout must be less than the number of variables" );
+	if ( ( spec.kind == "sync" ) && ( spec.fanout > spec.dims[ 0 ] ) ) invalid( model, "fanout must not exceed the number of sources" );
+	return spec;
+}
+
+// Spread in [0,1) of Variable i: Golden ratio sequence so neighbors differ
+double
+spread( size_type const i )
+{
+	double const s( 0.6180339887498949 * double( i ) );
+	return s - std::floor( s );
+}
+
+// New Variable of the Selected QSS Method
+V *
+new_var( std::string const & name, double const xIni )
+{
+	using namespace options;
+	if ( qss == QSS::QSS1 ) {
+		return new Variable_QSS1< Function_LTI >( name, rTol, aTol, xIni );
+	} else if ( qss == QSS::QSS2 ) {
+		return new Variable_QSS2< Function_LTI >( name, rTol, aTol, xIni );
+	} else if ( qss == QSS::QSS3 ) {
+		return new Variable_QSS3< Function_LTI >( name, rTol, aTol, xIni );
+	} else if ( qss == QSS::LIQSS1 ) {
+		return new Variable_LIQSS1< Function_LTI >( name, rTol, aTol, xIni );
+	} else if ( qss == QSS::LIQSS2 ) {
+		return new Variable_LIQSS2< Function_LTI >( name, rTol, aTol, xIni );
+	} else {
+		throw std::runtime_error( "Unsupported QSS method" );
+	}
+}
+
+} // Internal
+
+// Synthetic Model Spec?
+bool
+is_synthetic( std::string const & model )
+{
+	std::string::size_type const colon( model.find( ':' ) );
+	if ( colon == std::string::npos ) return false;
+	std::string const kind( model.substr( 0u, colon ) );
+	for ( Kind const & k : kinds ) {
+		if ( kind == k.name ) return true;
+	}
+	return false;
+}
+
+// Synthetic Scalable LTI Model Setup
+void
+synthetic( std::string const & model, Variables & vars )
+{
+	if ( ! is_synthetic( model ) ) invalid( model, "Unknown kind: Use chain, grid2d, grid3d, graph, blocks, or sync" );
+	Spec const spec( spec_of( model ) );
+	double const k( spec.coupling );
+
+	// Variables
+	size_type n( 1u );
+	for ( size_type const d : spec.dims ) n *= d;
+	if ( spec.kind == "sync" ) n = spec.dims[ 0 ] + spec.dims[ 1 ]; // Sources then observers
+	std::vector< V * > x;
+	x.reserve( n );
+	if ( spec.kind == "grid2d" ) {
+		size_type const nx( spec.dims[ 0 ] );
+		for ( size_type i = 0; i < n; ++i ) {
+			x.push_back( new_var( "x_" + std::to_string( ( i % nx ) + 1u ) + '_' + std::to_string( ( i / nx ) + 1u ), spread( i ) ) );
+		}
+	} else if ( spec.kind == "grid3d" ) {
+		size_type const nx( spec.dims[ 0 ] ), nxy( nx * spec.dims[ 1 ] );
+		for ( size_type i = 0; i < n; ++i ) {
+			x.push_back( new_var( "x_" + std::to_string( ( i % nx ) + 1u ) + '_' + std::to_string( ( ( i % nxy ) / nx ) + 1u ) + '_' + std::to_string( ( i / nxy ) + 1u ), spread( i ) ) );
+		}
+	} else if ( spec.kind == "blocks" ) {
+		size_type const bs( spec.dims[ 1 ] );
+		for ( size_type i = 0; i < n; ++i ) {
+			x.push_back( new_var( "b" + std::to_string( ( i / bs ) + 1u ) + "_x" + std::to_string( ( i % bs ) + 1u ), spread( i ) ) );
+		}
+	} else if ( spec.kind == "sync" ) {
+		size_type const ns( spec.dims[ 0 ] );
+		for ( size_type i = 0; i < n; ++i ) {
+			x.push_back( i < ns ? new_var( "s" + std::to_string( i + 1u ), 0.0 ) : new_var( "y" + std::to_string( i - ns + 1u ), spread( i ) ) );
+		}
+	} else { // chain or graph
+		for ( size_type i = 0; i < n; ++i ) {
+			x.push_back( new_var( "x" + std::to_string( i + 1u ), spread( i ) ) );
+		}
+	}
+
+	// Couplings: Dependencies and weights w_ij per variable
+	using Coupling = std::pair< size_type, double >;
+	std::vector< std::vector< Coupling > > deps( n );
+	size_type const n_sources( spec.kind == "sync" ? spec.dims[ 0 ] : 0u );
+	if ( spec.kind == "chain" ) {
+		for ( size_type i = 0; i < n; ++i ) {
+			if ( i > 0u ) deps[ i ].emplace_back( i - 1u, k );
+			if ( i + 1u < n ) deps[ i ].emplace_back( i + 1u, k );
+		}
+	} else if ( ( spec.kind == "grid2d" ) || ( spec.kind == "grid3d" ) ) { // No-flux boundaries
+		size_type const nx( spec.dims[ 0 ] ), ny( spec.dims[ 1 ] ), nz( spec.dims.size() > 2u ? spec.dims[ 2 ] : 1u );
+		size_type const nxy( nx * ny );
+		for ( size_type i = 0; i < n; ++i ) {
+			size_type const ix( i % nx ), iy( ( i % nxy ) / nx ), iz( i / nxy );
+			if ( ix > 0u ) deps[ i ].emplace_back( i - 1u, k );
+			if ( ix + 1u < nx ) deps[ i ].emplace_back( i + 1u, k );
+			if ( iy > 0u ) deps[ i ].emplace_back( i - nx, k );
+			if ( iy + 1u < ny ) deps[ i ].emplace_back( i + nx, k );
+			if ( iz > 0u ) deps[ i ].emplace_back( i - nxy, k );
+			if ( iz + 1u < nz ) deps[ i ].emplace_back( i + nxy, k );
+		}
+	} else if ( spec.kind == "graph" ) { // Distinct random dependencies
+		std::mt19937_64 rng( spec.seed );
+		double const wij( k / double( spec.fanout ) );
+		std::vector< size_type > js;
+		for ( size_type i = 0; i < n; ++i ) {
+			js.clear();
+			while ( js.size() < spec.fanout ) {
+				size_type const j( size_type( rng() % n ) ); // Portable unlike std::uniform_int_distribution
+				if ( ( j != i ) && ( std::find( js.begin(), js.end(), j ) == js.end() ) ) js.push_back( j );
+			}
+			for ( size_type const j : js ) deps[ i ].emplace_back( j, wij );
+		}
+	} else if ( spec.kind == "blocks" ) { // Dense within blocks: Block leads weakly coupled in a ring
+		size_type const nb( spec.dims[ 0 ] ), bs( spec.dims[ 1 ] );
+		double const wij( 1.0 / double( bs ) );
+		for ( size_type i = 0; i < n; ++i ) {
+			size_type const b( ( i / bs ) * bs );
+			for ( size_type j = b; j < b + bs; ++j ) {
+				if ( j != i ) deps[ i ].emplace_back( j, wij );
+			}
+		}
+		if ( nb > 1u ) {
+			for ( size_type b = 0; b < nb; ++b ) {
+				deps[ b * bs ].emplace_back( ( ( b + 1u ) % nb ) * bs, k );
+			}
+		}
+	} else if ( spec.kind == "sync" ) { // Observers depend on distinct random sources
+		std::mt19937_64 rng( spec.seed );
+		double const wij( k / double( spec.fanout ) );
+		std::vector< size_type > js;
+		for ( size_type i = n_sources; i < n; ++i ) {
+			js.clear();
+			while ( js.size() < spec.fanout ) {
+				size_type const j( size_type( rng() % n_sources ) );
+				if ( std::find( js.begin(), js.end(), j ) == js.end() ) js.push_back( j );
+			}
+			for ( size_type const j : js ) deps[ i ].emplace_back( j, wij );
+		}
+	}
+
+	// Derivatives: dx_i/dt = b_i - a_i x_i + sum_j w_ij ( x_j - x_i )
+	for ( size_type i = 0; i < n; ++i ) {
+		auto & d( x[ i ]->d() );
+		if ( i < n_sources ) { // Sync source
+			d.add( 1.0 ).add( -1.0, x[ i ] );
+			continue;
+		}
+		if ( i == 0u ) d.add( 1.0 ); // Source
+		double self( -std::pow( spec.stiffness, spread( i ) ) ); // Decay rate in [1,R]
+		for ( Coupling const & c : deps[ i ] ) {
+			d.add( c.second, x[ c.first ] );
+			self -= c.second;
+		}
+		d.add( self, x[ i ] );
+	}
+
+	vars.clear();
+	vars.reserve( n );
+	for ( V * v : x ) vars.push_back( v );
+}
+
+} // ex
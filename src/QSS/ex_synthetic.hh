@@ -0,0 +1,49 @@
+#ifndef QSS_ex_synthetic_hh_INCLUDED
+#define QSS_ex_synthetic_hh_INCLUDED
+
+// Synthetic Scalable LTI Model Setup
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (http://objexx.com)
+// under contract to the National Renewable Energy Laboratory
+// of the U.S. Department of Energy
+
+// Model spec: KIND:DIMS[,key=value]...
+//  chain:N        1-D diffusion chain of N variables
+//  grid2d:NXxNY   2-D heat diffusion grid (5-point stencil)
+//  grid3d:NXxNYxNZ 3-D heat diffusion grid (7-point stencil)
+//  graph:N        Random sparse graph: Each variable depends on fanout others
+//  blocks:NBxBS   NB densely coupled blocks of BS variables with weak coupling between blocks
+//  sync:NSxNO     NS identical sources that always requantize together observed by NO variables: Each depends on fanout sources
+// Keys:
+//  coupling=K     Coupling strength: Diffusion coefficient, graph edge weight sum, or inter-block weight  [1|blocks:0.01]
+//  stiffness=R    Decay rates spread over [1,R]: Stiffness ratio  [1]
+//  fanout=F       Graph or sync observer dependencies per variable  [4]
+//  seed=S         Graph or sync random seed  [1]
+// Dynamics: dx_i/dt = b_i - a_i x_i + sum_j w_ij ( x_j - x_i ) with b = 1 at the first variable and 0 elsewhere
+// Sync sources have b = 1, a = 1, and start at 0 so each requantization is a simultaneous batch of NS triggers
+// The QSS method is set by --qss as for the other example models
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// Forward
+class Variable;
+
+namespace ex {
+
+using Variables = std::vector< Variable * >;
+
+// Synthetic Model Spec?
+bool
+is_synthetic( std::string const & model );
+
+// Synthetic Scalable LTI Model Setup
+void
+synthetic( std::string const & model, Variables & vars );
+
+} // ex
+
+#endif
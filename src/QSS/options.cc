@@ -29,8 +29,28 @@ double dtND( 1.0e-6 ); // Numeric differentiation time step (s)  [1e-6]
 double one_half_over_dtND( 5.0e5 ); // 0.5 / dtND  [computed]
 double tEnd( 1.0 ); // End time (s)  [1|FMU]
 bool tEnd_set( false ); // End time set?
+int cis( 1 ); // FMU completed integrator step call interval (events): 0 => First event after each sampled output time  [1]
+Async async( Async::None ); // Asynchronous output writer backpressure: None => Synchronous output  [None]
+int async_buffer( 65536 ); // Asynchronous output ring buffer size (records)  [65536]
+int fmus( 1 ); // FMU instances for parallel evaluation of QSS variable partitions  [1]
+int threads( 1 ); // Threads for parallel observer advances of example models  [1]
+std::size_t par_fanout( 64u ); // Min observers of a trigger to advance them in parallel  [64]
+std::size_t par_batch( 8u ); // Min simultaneous triggers to advance their observers together in parallel  [8]
 std::string out; // Outputs: r, a, s, x, q, f  [rx]
 std::string model; // Name of model or FMU
+std::string convert; // Output, trace, or text model file to convert
+std::string stream; // Live output stream Unix domain socket or FIFO path  []
+std::string trace; // Solver phase trace file: .json => Chrome trace JSON else binary  []
+std::string cache; // FMU unpack cache directory: Empty => No cache  []
+bool verbose( false ); // Verbose FMU model description output?  [F]
+std::vector< std::string > var; // Output variable name patterns: Glob or re:regex  []
+std::string var_file; // Output variable name pattern list file  []
+std::vector< std::string > causality; // Output FMU variable causalities  []
+double dtOutMin( 0.0 ); // Min time between a variable's requantization outputs (s)  [0]
+double dxOutMin( 0.0 ); // Min value change between a variable's requantization outputs  [0]
+std::size_t stats( 10u ); // Requantization statistics report top variables and edges: QSS_STATS builds only  [10]
+bool perf_counters( false ); // Hardware performance counters by solver phase: QSS_STATS builds only  [F]
+bool memory( false ); // Memory footprint report by subsystem?  [F]
 
 namespace output { // Output selections
 
@@ -38,9 +58,15 @@ bool r( true ); // Requantization events?  [T]
 bool a( false ); // All variables at requantization events?  [F]
 bool s( false ); // Sampled output?  [F]
 bool f( true ); // FMU outputs?  [T]
+#ifdef QSS_DIAGNOSTICS
 bool d( false ); // Diagnostic output?  [F]
+#endif
 bool x( true ); // Continuous trajectories?  [T]
 bool q( false ); // Quantized trajectories?  [F]
+bool b( false ); // Binary output file instead of text files?  [F]
+bool z( false ); // Compressed binary output file (=> b)?  [F]
+bool m( false ); // Memory-mapped output file instead of text files?  [F]
+bool p( false ); // Trajectory polynomial segments file?  [F]
 
 } // out
 
@@ -84,6 +110,25 @@ double_of( std::string const & s )
 	return std::stod( s ); // Check is_double first
 }
 
+// string is Readable as an int?
+inline
+bool
+is_int( std::string const & s )
+{
+	char const * str( s.c_str() );
+	char * end;
+	static_cast< void >( std::strtol( str, &end, 10 ) );
+	return ( ( end != str ) && is_tail( end ) );
+}
+
+// int of a string
+inline
+int
+int_of( std::string const & s )
+{
+	return std::stoi( s ); // Check is_int first
+}
+
 // Has an Option (Case-Insensitive)?
 bool
 has_option( std::string const & s, char const * const option )
@@ -155,6 +200,7 @@ help_display()
 {
 	std::cout << '\n' << "QSS [options] [model|fmu]" << "\n\n";
 	std::cout << "Options:" << "\n\n";
+	std::cout << " --model=MODEL Model name, synthetic model spec, model file, or FMU file: Alternative to [model|fmu]" << '\n';
 	std::cout << " --qss=METHOD  QSS method: (LI)QSS1|2|3  [QSS2]" << '\n';
 	std::cout << " --inflection  Requantize at inflections?  [F]" << '\n';
 	std::cout << " --rTol=TOL    Relative tolerance  [1e-4|FMU]" << '\n';
@@ -162,14 +208,42 @@ help_display()
 	std::cout << " --dtOut=STEP  Sampled & FMU output step (s)  [1e-3]" << '\n';
 	std::cout << " --dtND=STEP   Numeric differentiation step (s)  [1e-6]" << '\n';
 	std::cout << " --tEnd=TIME   End time (s)  [1|FMU]" << '\n';
-	std::cout << " --out=OUTPUTS Outputs: r, a, s, d, x, q, f  [rfx]" << '\n';
+	std::cout << " --cis=EVENTS  FMU completed integrator step interval: 0 => First event after each sampled output time  [1]" << '\n';
+	std::cout << "               0 requires sampled (s with x or q) or FMU (f) output in --out" << '\n';
+	std::cout << "               Calls are made at event times: Event mode requests run the FMU event iteration there" << '\n';
+	std::cout << " --fmus=N      FMU instances for parallel evaluation  [1]" << '\n';
+	std::cout << " --threads=N   Threads for parallel observer advances of example and synthetic models  [1]" << '\n';
+	std::cout << " --par-fanout=N Min observers of a trigger to advance them in parallel  [64]" << '\n';
+	std::cout << " --par-batch=N Min simultaneous triggers to advance their observers together in parallel  [8]" << '\n';
+	std::cout << " --cache=DIR   FMU unpack cache directory  []" << '\n';
+	std::cout << " --verbose     Verbose FMU model description output  [F]" << '\n';
+	std::cout << " --async=BACKPRESSURE Asynchronous output writer: block|drop (drop requires s in --out)  []" << '\n';
+	std::cout << " --buffer=RECORDS Asynchronous output buffer size  [65536]" << '\n';
+	std::cout << " --var=PATTERN Output variables matching name glob (* ?) or re:regex (repeatable)  [all]" << '\n';
+	std::cout << " --var-file=FILE Output variable name patterns file: One per line  []" << '\n';
+	std::cout << " --causality=LIST Output FMU variables with causalities: output,local,...  [all]" << '\n';
+	std::cout << " --dtOutMin=STEP Min time between a variable's requantization outputs (s)  [0]" << '\n';
+	std::cout << " --dxOutMin=DELTA Min value change between a variable's requantization outputs  [0]" << '\n';
+	std::cout << " --out=OUTPUTS Outputs: r, a, s, d, x, q, f, b, z, m, p  [rfx]" << '\n';
 	std::cout << "       r       Requantization events" << '\n';
 	std::cout << "       a       All variables at requantizations (=> r)" << '\n';
 	std::cout << "       s       Sampled time steps" << '\n';
 	std::cout << "       f       FMU outputs" << '\n';
-	std::cout << "       d       Diagnostic output" << '\n';
+	std::cout << "       d       Diagnostic output: QSS_DIAGNOSTICS builds only" << '\n';
 	std::cout << "       x       Continuous trajectories" << '\n';
 	std::cout << "       q       Quantized trajectories" << '\n';
+	std::cout << "       b       Binary output file: model.qss" << '\n';
+	std::cout << "       z       Compressed binary output file: model.qss (=> b)" << '\n';
+	std::cout << "       m       Memory-mapped output file: model.qssm" << '\n';
+	std::cout << "       p       Trajectory polynomial segments file: model.seg" << '\n';
+	std::cout << " --stream=PATH Also stream outputs live to a Unix domain socket or existing FIFO at PATH  []" << '\n';
+	std::cout << " --trace=FILE  Solver phase timeline trace: FILE.json => Chrome trace JSON else binary for --convert  []" << '\n';
+	std::cout << " --stats=N     Requantization statistics report: Top N variables and edges: QSS_STATS builds only  [10]" << '\n';
+	std::cout << " --counters    Linux hardware performance counters of the solver thread by phase: QSS_STATS builds only" << '\n';
+	std::cout << " --memory      Memory footprint report by subsystem: Estimated heap bytes per variable and per observer edge" << '\n';
+	std::cout << " --convert=FILE Convert binary, memory-mapped, or segments (sampled at --dtOut) output file to text files" << '\n';
+	std::cout << "                or binary trace file trace.qsst to Chrome trace JSON file trace.json" << '\n';
+	std::cout << "                or text model file model.qsm to binary model file model.qsmb" << '\n';
 	std::cout << '\n';
 	std::cout << "Models:" << "\n\n";
 	std::cout << "  achilles : Achilles and the Tortoise" << '\n';
@@ -185,11 +259,76 @@ help_display()
 	std::cout << "  xy : Simple 2 variable model" << '\n';
 	std::cout << "  xyz : Simple 3 variable model" << '\n';
 	std::cout << '\n';
+	std::cout << "Synthetic models: KIND:DIMS[,key=value]..." << "\n\n";
+	std::cout << "  chain:N : 1-D diffusion chain" << '\n';
+	std::cout << "  grid2d:NXxNY : 2-D heat diffusion grid" << '\n';
+	std::cout << "  grid3d:NXxNYxNZ : 3-D heat diffusion grid" << '\n';
+	std::cout << "  graph:N : Random sparse graph" << '\n';
+	std::cout << "  blocks:NBxBS : Weakly coupled dense blocks" << '\n';
+	std::cout << "  Keys: coupling=K [1|blocks:0.01], stiffness=R [1], fanout=F [4], seed=S [1]" << '\n';
+	std::cout << "  Example: --model=grid3d:100x100x10,stiffness=1000 --out=s --var=x_1_1_1" << '\n';
+	std::cout << '\n';
+	std::cout << "Model files: LTI models with sine inputs" << "\n\n";
+	std::cout << "  model.qsm : Text: qss, var, inp, and der statements (see Model_File.hh)" << '\n';
+	std::cout << "  model.qsmb : Binary: Memory-mapped for fast loading of large models (--convert=model.qsm)" << '\n';
+	std::cout << '\n';
 }
 
-// Process command line arguments
+// Reset Options to Defaults
 void
-process_args( int argc, char * argv[] )
+reset()
+{
+	qss = QSS::QSS2;
+	qss_order = 2;
+	inflection = false;
+	rTol = 1.0e-4;
+	aTol = 1.0e-6;
+	rTol_set = false;
+	dtOut = 1.0e-3;
+	dtND = 1.0e-6;
+	one_half_over_dtND = 5.0e5;
+	tEnd = 1.0;
+	tEnd_set = false;
+	cis = 1;
+	async = Async::None;
+	async_buffer = 65536;
+	fmus = 1;
+	threads = 1;
+	par_fanout = 64u;
+	par_batch = 8u;
+	out.clear();
+	model.clear();
+	convert.clear();
+	stream.clear();
+	trace.clear();
+	cache.clear();
+	verbose = false;
+	var.clear();
+	var_file.clear();
+	causality.clear();
+	dtOutMin = 0.0;
+	dxOutMin = 0.0;
+	stats = 10u;
+	perf_counters = false;
+	memory = false;
+	output::r = true;
+	output::a = false;
+	output::s = false;
+	output::f = true;
+#ifdef QSS_DIAGNOSTICS
+	output::d = false;
+#endif
+	output::x = true;
+	output::q = false;
+	output::b = false;
+	output::z = false;
+	output::m = false;
+	output::p = false;
+}
+
+// Parse command line arguments
+Args
+parse_args( int argc, char * argv[] )
 {
 	bool help( false );
 	if ( argc == 1 ) { // No arguments: Show help
@@ -230,6 +369,67 @@ process_args( int argc, char * argv[] )
 			}
 		} else if ( has_option( arg, "inflection" ) ) {
 			inflection = true;
+		} else if ( has_value_option( arg, "cache" ) ) {
+			cache = arg_value( arg );
+			if ( cache.empty() ) {
+				std::cerr << "Empty cache directory" << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option( arg, "verbose" ) ) {
+			verbose = true;
+		} else if ( has_value_option( arg, "var" ) ) {
+			std::string const var_str( arg_value( arg ) );
+			if ( var_str.empty() ) {
+				std::cerr << "Empty var pattern" << std::endl;
+				fatal = true;
+			} else {
+				var.push_back( var_str );
+			}
+		} else if ( has_value_option( arg, "var-file" ) ) {
+			var_file = arg_value( arg );
+			if ( var_file.empty() ) {
+				std::cerr << "Empty var-file name" << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "causality" ) ) {
+			std::string const causality_str( arg_value( arg ) );
+			std::string::size_type b( 0u );
+			while ( b <= causality_str.length() ) {
+				std::string::size_type e( causality_str.find( ',', b ) );
+				if ( e == std::string::npos ) e = causality_str.length();
+				std::string const c( causality_str.substr( b, e - b ) );
+				if ( ( c == "parameter" ) || ( c == "calculatedParameter" ) || ( c == "input" ) || ( c == "output" ) || ( c == "local" ) || ( c == "independent" ) ) {
+					causality.push_back( c );
+				} else {
+					std::cerr << "Causality not in parameter|calculatedParameter|input|output|local|independent: " << c << std::endl;
+					fatal = true;
+				}
+				b = e + 1u;
+			}
+		} else if ( has_value_option( arg, "dtOutMin" ) ) {
+			std::string const dtOutMin_str( arg_value( arg ) );
+			if ( is_double( dtOutMin_str ) ) {
+				dtOutMin = double_of( dtOutMin_str );
+				if ( dtOutMin < 0.0 ) {
+					std::cerr << "Negative dtOutMin: " << dtOutMin_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "Nonnumeric dtOutMin: " << dtOutMin_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "dxOutMin" ) ) {
+			std::string const dxOutMin_str( arg_value( arg ) );
+			if ( is_double( dxOutMin_str ) ) {
+				dxOutMin = double_of( dxOutMin_str );
+				if ( dxOutMin < 0.0 ) {
+					std::cerr << "Negative dxOutMin: " << dxOutMin_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "Nonnumeric dxOutMin: " << dxOutMin_str << std::endl;
+				fatal = true;
+			}
 		} else if ( has_value_option( arg, "rTol" ) ) {
 			std::string const rTol_str( arg_value( arg ) );
 			if ( is_double( rTol_str ) ) {
@@ -293,27 +493,171 @@ process_args( int argc, char * argv[] )
 				std::cerr << "Nonnumeric tEnd: " << tEnd_str << std::endl;
 				fatal = true;
 			}
+		} else if ( has_value_option( arg, "cis" ) ) {
+			std::string const cis_str( arg_value( arg ) );
+			if ( is_int( cis_str ) ) {
+				cis = int_of( cis_str );
+				if ( cis < 0 ) {
+					std::cerr << "Negative cis: " << cis_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "Nonintegral cis: " << cis_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "async" ) ) {
+			std::string const async_name( uppercased( arg_value( arg ) ) );
+			if ( async_name == "BLOCK" ) {
+				async = Async::Block;
+			} else if ( async_name == "DROP" ) {
+				async = Async::Drop;
+			} else {
+				std::cerr << "Unsupported async backpressure: " << async_name << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "buffer" ) ) {
+			std::string const buffer_str( arg_value( arg ) );
+			if ( is_int( buffer_str ) ) {
+				async_buffer = int_of( buffer_str );
+				if ( async_buffer < 1 ) {
+					std::cerr << "Nonpositive buffer: " << buffer_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "Nonintegral buffer: " << buffer_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "stats" ) ) {
+			std::string const stats_str( arg_value( arg ) );
+			if ( is_int( stats_str ) && ( int_of( stats_str ) >= 0 ) ) {
+				stats = std::size_t( int_of( stats_str ) );
+#ifndef QSS_STATS
+				std::cerr << "Requantization statistics are not compiled in: Build with QSS_STATS defined" << std::endl;
+#endif
+			} else {
+				std::cerr << "Invalid stats count: " << stats_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option( arg, "counters" ) ) {
+			perf_counters = true;
+#ifndef QSS_STATS
+			std::cerr << "Performance counters are not compiled in: Build with QSS_STATS defined" << std::endl;
+#endif
+		} else if ( has_option( arg, "memory" ) ) {
+			memory = true;
+		} else if ( has_value_option( arg, "fmus" ) ) {
+			std::string const fmus_str( arg_value( arg ) );
+			if ( is_int( fmus_str ) ) {
+				fmus = int_of( fmus_str );
+				if ( fmus < 1 ) {
+					std::cerr << "Nonpositive fmus: " << fmus_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "Nonintegral fmus: " << fmus_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "threads" ) ) {
+			std::string const threads_str( arg_value( arg ) );
+			if ( is_int( threads_str ) ) {
+				threads = int_of( threads_str );
+				if ( threads < 1 ) {
+					std::cerr << "Nonpositive threads: " << threads_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "Nonintegral threads: " << threads_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "par-fanout" ) ) {
+			std::string const par_fanout_str( arg_value( arg ) );
+			if ( is_int( par_fanout_str ) && ( int_of( par_fanout_str ) >= 1 ) ) {
+				par_fanout = std::size_t( int_of( par_fanout_str ) );
+			} else {
+				std::cerr << "Invalid par-fanout: " << par_fanout_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "par-batch" ) ) {
+			std::string const par_batch_str( arg_value( arg ) );
+			if ( is_int( par_batch_str ) && ( int_of( par_batch_str ) >= 2 ) ) {
+				par_batch = std::size_t( int_of( par_batch_str ) );
+			} else {
+				std::cerr << "Invalid par-batch: " << par_batch_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "convert" ) ) {
+			convert = arg_value( arg );
+			if ( convert.empty() ) {
+				std::cerr << "Empty convert file name" << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "trace" ) ) {
+			trace = arg_value( arg );
+			if ( trace.empty() ) {
+				std::cerr << "Empty trace file name" << std::endl;
+				fatal = true;
+			}
+		} else if ( has_value_option( arg, "stream" ) ) {
+			stream = arg_value( arg );
+			if ( stream.empty() ) {
+				std::cerr << "Empty stream path" << std::endl;
+				fatal = true;
+			}
 		} else if ( has_value_option( arg, "out" ) ) {
 			out = arg_value( arg );
-			if ( has_any_not_of( out, "rasfdxq" ) ) {
-				std::cerr << "Output flag not in rasfdxq: " << out << std::endl;
+			if ( has_any_not_of( out, "rasfdxqbzmp" ) ) {
+				std::cerr << "Output flag not in rasfdxqbzmp: " << out << std::endl;
 				fatal = true;
 			}
 			output::r = has( out, 'r' );
 			output::a = has( out, 'a' );
 			output::s = has( out, 's' );
 			output::f = has( out, 'f' );
+#ifdef QSS_DIAGNOSTICS
 			output::d = has( out, 'd' );
+#else
+			if ( has( out, 'd' ) ) std::cerr << "Diagnostic output is not compiled in: Build with QSS_DIAGNOSTICS defined" << std::endl;
+#endif
 			output::x = has( out, 'x' );
 			output::q = has( out, 'q' );
+			output::z = has( out, 'z' );
+			output::b = has( out, 'b' ) || output::z; // z => b
+			output::m = has( out, 'm' );
+			if ( output::b && output::m ) {
+				std::cerr << "Output flags b/z and m are exclusive: " << out << std::endl;
+				fatal = true;
+			}
+			output::p = has( out, 'p' );
 			if ( output::a ) output::r = true; // a => r
+		} else if ( has_value_option( arg, "model" ) ) {
+			model = arg_value( arg );
 		} else { // Treat non-option argument as model
 			model = arg;
 		}
 	}
 
-	if ( help ) std::exit( EXIT_SUCCESS );
-	if ( fatal ) std::exit( EXIT_FAILURE );
+	if ( ( async == Async::Drop ) && output::r && ( ! output::s ) ) { // Dropped requantization records must leave a complete sampled trajectory
+		std::cerr << "Async drop backpressure requires sampled output: Add s to --out or use --async=block" << std::endl;
+		fatal = true;
+	}
+
+	if ( ( cis == 0 ) && ( ! ( ( output::s && ( output::x || output::q ) ) || output::f ) ) ) { // Sampled calls need output sample times
+		std::cerr << "FMU completed integrator step calls at sampled output times require sampled or FMU output: Add s or f to --out or use --cis=N with N > 0" << std::endl;
+		fatal = true;
+	}
+
+	if ( help ) return Args::Help;
+	if ( fatal ) return Args::Fatal;
+	return Args::Run;
+}
+
+// Process command line arguments: Exits on help or invalid arguments
+void
+process_args( int argc, char * argv[] )
+{
+	Args const args( parse_args( argc, argv ) );
+	if ( args == Args::Help ) std::exit( EXIT_SUCCESS );
+	if ( args == Args::Fatal ) std::exit( EXIT_FAILURE );
 }
 
 } // options
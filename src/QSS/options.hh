@@ -10,7 +10,9 @@
 // of the U.S. Department of Energy
 
 // C++ Headers
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace options {
 
@@ -35,8 +37,34 @@ extern double dtND; // Numeric differentiation time step (s)  [1e-6]
 extern double one_half_over_dtND; // 0.5 / dtND  [computed]
 extern double tEnd; // End time (s)  [1|FMU]
 extern bool tEnd_set; // End time set?
+extern int cis; // FMU completed integrator step call interval (events): 0 => First event after each sampled output time  [1]
+enum class Async {
+ None,
+ Block,
+ Drop
+};
+
+extern Async async; // Asynchronous output writer backpressure: None => Synchronous output  [None]
+extern int async_buffer; // Asynchronous output ring buffer size (records)  [65536]
+extern int fmus; // FMU instances for parallel evaluation of QSS variable partitions  [1]
+extern int threads; // Threads for parallel observer advances of example models  [1]
+extern std::size_t par_fanout; // Min observers of a trigger to advance them in parallel  [64]
+extern std::size_t par_batch; // Min simultaneous triggers to advance their observers together in parallel  [8]
 extern std::string out; // Outputs: r, a, s, x, q, f  [rx]
 extern std::string model; // Name of model or FMU
+extern std::string convert; // Output, trace, or text model file to convert
+extern std::string stream; // Live output stream Unix domain socket or FIFO path  []
+extern std::string trace; // Solver phase trace file: .json => Chrome trace JSON else binary  []
+extern std::string cache; // FMU unpack cache directory: Empty => No cache  []
+extern bool verbose; // Verbose FMU model description output?  [F]
+extern std::vector< std::string > var; // Output variable name patterns: Glob or re:regex  []
+extern std::string var_file; // Output variable name pattern list file  []
+extern std::vector< std::string > causality; // Output FMU variable causalities  []
+extern double dtOutMin; // Min time between a variable's requantization outputs (s)  [0]
+extern double dxOutMin; // Min value change between a variable's requantization outputs  [0]
+extern std::size_t stats; // Requantization statistics report top variables and edges: QSS_STATS builds only  [10]
+extern bool perf_counters; // Hardware performance counters by solver phase: QSS_STATS builds only  [F]
+extern bool memory; // Memory footprint report by subsystem?  [F]
 
 namespace output { // Output selections
 
@@ -44,13 +72,36 @@ extern bool r; // Requantization events?  [T]
 extern bool a; // All variables at requantization events?  [F]
 extern bool s; // Sampled output?  [F]
 extern bool f; // FMU outputs?  [T]
+#ifdef QSS_DIAGNOSTICS
 extern bool d; // Diagnostic output?  [F]
+#else
+bool const d( false ); // Diagnostic output: QSS_DIAGNOSTICS builds only  [F]
+#endif
 extern bool x; // Continuous trajectories?  [T]
 extern bool q; // Quantized trajectories?  [F]
+extern bool b; // Binary output file instead of text files?  [F]
+extern bool z; // Compressed binary output file (=> b)?  [F]
+extern bool m; // Memory-mapped output file instead of text files?  [F]
+extern bool p; // Trajectory polynomial segments file?  [F]
 
 } // out
 
-// Process command line arguments
+// Command Line Arguments Outcome
+enum class Args {
+ Run, // Arguments valid
+ Help, // Help shown
+ Fatal // Invalid arguments
+};
+
+// Reset Options to Defaults
+void
+reset();
+
+// Parse command line arguments
+Args
+parse_args( int argc, char * argv[] );
+
+// Process command line arguments: Exits on help or invalid arguments
 void
 process_args( int argc, char * argv[] );
 
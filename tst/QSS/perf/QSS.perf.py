@@ -0,0 +1,194 @@
+#!/usr/bin/env python
+
+# QSS Solver End-to-End Benchmark Suite
+#
+# Language: Python (2.7 or 3.x)
+#
+# Project: QSS Solver
+#
+# Developed by Objexx Engineering, Inc. (http://objexx.com)
+# under contract to the National Renewable Energy Laboratory
+# of the U.S. Department of Energy
+
+# Notes:
+# . Runs a fixed matrix of models x QSS methods with the QSS executable, each in its own scratch directory
+# . Reports wall time, requantization events/s, observer advances/s, peak RSS, and output bytes as JSON
+# . Wall time is the min over --repeat runs and peak RSS is the max: Counts must match across repeats
+# . --compare flags regressions against a stored baseline JSON and exits nonzero if there are any
+# . Peak RSS comes from wait4 so it is per run: Reported as 0 where wait4 is unavailable (Windows)
+# . --counters adds the solver's Linux perf_event_open counters by phase (QSS_STATS builds) from the fastest run
+# . Counter changes against a baseline are reported but not flagged: They vary with the host CPU and load
+# . The solver's estimated heap bytes by subsystem (--memory) are recorded per case and total growth is flagged like peak RSS
+# . Usage: QSS.perf.py [--qss=PATH] [--quick] [--counters] [--json=FILE] [--compare=BASELINE] [--threshold=FRACTION]
+
+# Imports
+from __future__ import print_function
+import argparse, json, os, platform, re, shutil, subprocess, sys, tempfile, time
+
+# Globals
+Methods = [ 'QSS1', 'QSS2', 'QSS3', 'LIQSS1', 'LIQSS2' ]
+Models = [ # ( model, extra arguments, quick? )
+    ( 'achilles', [ '--tEnd=10', '--out=rx' ], True ),
+    ( 'exponential_decay_sine', [ '--tEnd=50', '--out=rx' ], True ),
+    ( 'nonlinear', [ '--tEnd=5', '--out=rx' ], True ),
+    ( 'stiff', [ '--tEnd=100', '--out=rx' ], False ),
+    ( 'xyz', [ '--tEnd=10', '--out=rx' ], False ),
+    ( 'chain:1000', [ '--tEnd=1', '--rTol=1e-3', '--aTol=1e-4', '--out=rxb' ], True ),
+    ( 'grid3d:20x20x10,stiffness=100', [ '--tEnd=0.5', '--rTol=1e-3', '--aTol=1e-4', '--out=rxb' ], False ),
+    ( 'graph:10000,fanout=4', [ '--tEnd=0.5', '--rTol=1e-3', '--aTol=1e-4', '--out=rxb' ], False ),
+    ( 'blocks:500x8,stiffness=1000', [ '--tEnd=0.5', '--rTol=1e-3', '--aTol=1e-4', '--out=rxb' ], False ),
+]
+Events_re = re.compile( r'^(\d+) total requantization events occurred', re.M )
+Advances_re = re.compile( r'^(\d+) total observer advances occurred', re.M )
+Counters_re = re.compile( r'^Performance counters:.*\n  phase +(.*)\n((?:  \S+ +.*\n)+)', re.M )
+Memory_re = re.compile( r'^Memory footprint by subsystem.*\n  subsystem +.*\n((?:  \S+ +.*\n)+)', re.M )
+Timer = time.perf_counter if hasattr( time, 'perf_counter' ) else time.time
+
+# Main
+def main():
+
+    # Get options and arguments
+    parser = argparse.ArgumentParser( description = 'QSS solver end-to-end benchmark suite' )
+    parser.add_argument( '--qss', help = 'QSS executable [QSS]', default = 'QSS' )
+    parser.add_argument( '--quick', help = 'Run the quick subset of models', action = 'store_true' )
+    parser.add_argument( '--repeat', help = 'Runs per case [1]', type = int, default = 1 )
+    parser.add_argument( '--counters', help = 'Collect performance counters by solver phase (QSS_STATS builds)', action = 'store_true' )
+    parser.add_argument( '--json', help = 'Results JSON file [stdout]' )
+    parser.add_argument( '--compare', help = 'Baseline results JSON file to compare against' )
+    parser.add_argument( '--threshold', help = 'Regression threshold fraction [0.10]', type = float, default = 0.10 )
+    arg = parser.parse_args()
+    qss = shutil.which( arg.qss ) if hasattr( shutil, 'which' ) and shutil.which( arg.qss ) else os.path.abspath( arg.qss )
+    if not os.path.isfile( qss ):
+        raise IOError( 'QSS executable not found: ' + str( arg.qss ) )
+
+    # Run matrix
+    results = []
+    for model, args, quick in Models:
+        if arg.quick and not quick: continue
+        for method in Methods:
+            result = run_case( qss, model, method, args + [ '--memory' ] + ( [ '--counters' ] if arg.counters else [] ), max( arg.repeat, 1 ) )
+            results.append( result )
+            print( '{:<40} {:<7} {:>9.3f} s {:>12.0f} ev/s {:>12.0f} adv/s {:>9} KB {:>11} B'.format(
+             model, method, result[ 'wall_s' ], result[ 'events_per_s' ], result[ 'observer_advances_per_s' ], result[ 'peak_rss_kb' ], result[ 'output_bytes' ] ), file = sys.stderr )
+    report = { 'version': 1, 'host': platform.node(), 'platform': platform.platform(), 'qss': qss, 'date': time.strftime( '%Y-%m-%dT%H:%M:%S' ), 'results': results }
+
+    # Write results
+    if arg.json:
+        with open( arg.json, 'w' ) as json_file:
+            json.dump( report, json_file, indent = 1, sort_keys = True )
+    else:
+        print( json.dumps( report, indent = 1, sort_keys = True ) )
+
+    # Compare with baseline
+    if arg.compare:
+        with open( arg.compare ) as baseline_file:
+            baseline = json.load( baseline_file )
+        if compare( baseline, report, arg.threshold ) > 0: sys.exit( 1 )
+
+# Run a Benchmark Case
+def run_case( qss, model, method, args, repeat ):
+    wall = None
+    rss = 0
+    counters = None
+    memory = None
+    for r in range( repeat ):
+        run_dir = tempfile.mkdtemp( prefix = 'QSS.perf.' )
+        try:
+            command = [ qss, '--qss=' + method ] + args + [ '--model=' + model ]
+            beg = Timer()
+            process = subprocess.Popen( command, cwd = run_dir, stdout = subprocess.PIPE, stderr = subprocess.STDOUT )
+            if hasattr( os, 'wait4' ): # Reap the child ourselves to get its own resource usage
+                out = process.stdout.read().decode( 'utf-8', 'replace' )
+                process.stdout.close()
+                status, usage = os.wait4( process.pid, 0 )[ 1: ]
+                end = Timer()
+                process.returncode = os.WEXITSTATUS( status ) if os.WIFEXITED( status ) else -os.WTERMSIG( status )
+                rss = max( rss, usage.ru_maxrss // 1024 if sys.platform == 'darwin' else usage.ru_maxrss ) # macOS reports bytes
+            else:
+                out = process.communicate()[ 0 ].decode( 'utf-8', 'replace' )
+                end = Timer()
+            if process.returncode != 0:
+                raise RuntimeError( 'QSS run failed: ' + ' '.join( command ) + '\n' + out )
+            events = int( Events_re.search( out ).group( 1 ) )
+            advances = int( Advances_re.search( out ).group( 1 ) ) if Advances_re.search( out ) else 0
+            output_bytes = sum( os.path.getsize( os.path.join( run_dir, f ) ) for f in os.listdir( run_dir ) )
+            if ( wall is not None ) and ( ( events != result_events ) or ( advances != result_advances ) ):
+                raise RuntimeError( 'Nondeterministic event counts: ' + ' '.join( command ) )
+            if ( wall is None ) or ( end - beg < wall ): counters = parse_counters( out )
+            memory = parse_memory( out )
+            wall = ( end - beg ) if wall is None else min( wall, end - beg )
+            result_events, result_advances, result_bytes = events, advances, output_bytes
+        finally:
+            shutil.rmtree( run_dir, ignore_errors = True )
+    result = {
+     'model': model,
+     'qss': method,
+     'args': args,
+     'wall_s': wall,
+     'requant_events': result_events,
+     'events_per_s': result_events / wall if wall > 0.0 else 0.0,
+     'observer_advances': result_advances,
+     'observer_advances_per_s': result_advances / wall if wall > 0.0 else 0.0,
+     'peak_rss_kb': rss,
+     'output_bytes': result_bytes
+    }
+    if counters is not None: result[ 'counters' ] = counters
+    if memory is not None: result[ 'memory' ] = memory
+    return result
+
+# Parse the Performance Counters Table: Returns { phase: { event: count or None } } or None
+def parse_counters( out ):
+    match = Counters_re.search( out )
+    if not match: return None
+    events = match.group( 1 ).split()
+    counters = {}
+    for line in match.group( 2 ).splitlines():
+        fields = line.split()
+        counters[ fields[ 0 ] ] = dict( ( e, None if v == 'n/a' else float( v ) ) for e, v in zip( events, fields[ 1: ] ) )
+    return counters
+
+# Parse the Memory Footprint Table: Returns { subsystem: { bytes, per_variable, per_edge } } or None
+def parse_memory( out ):
+    match = Memory_re.search( out )
+    if not match: return None
+    memory = {}
+    for line in match.group( 1 ).splitlines():
+        fields = line.split()
+        memory[ fields[ 0 ] ] = { 'bytes': int( fields[ 1 ] ), 'per_variable': float( fields[ 2 ] ), 'per_edge': float( fields[ 3 ] ) }
+    return memory
+
+# Compare Results with a Baseline: Returns Number of Regressions
+def compare( baseline, report, threshold ):
+    base = dict( ( ( r[ 'model' ], r[ 'qss' ] ), r ) for r in baseline[ 'results' ] )
+    n_regressions = 0
+    for r in report[ 'results' ]:
+        key = ( r[ 'model' ], r[ 'qss' ] )
+        if key not in base:
+            print( 'NEW        {} {}'.format( *key ), file = sys.stderr )
+            continue
+        b = base[ key ]
+        notes = []
+        if r[ 'requant_events' ] != b[ 'requant_events' ]: # Solver behavior changed: Rates aren't comparable
+            notes.append( 'events {} -> {}'.format( b[ 'requant_events' ], r[ 'requant_events' ] ) )
+        if r[ 'events_per_s' ] < b[ 'events_per_s' ] * ( 1.0 - threshold ):
+            notes.append( 'events/s {:.0f} -> {:.0f} ({:+.1%})'.format( b[ 'events_per_s' ], r[ 'events_per_s' ], r[ 'events_per_s' ] / b[ 'events_per_s' ] - 1.0 ) )
+        if ( b[ 'peak_rss_kb' ] > 0 ) and ( r[ 'peak_rss_kb' ] > b[ 'peak_rss_kb' ] * ( 1.0 + threshold ) ):
+            notes.append( 'peak RSS {} -> {} KB'.format( b[ 'peak_rss_kb' ], r[ 'peak_rss_kb' ] ) )
+        if r[ 'output_bytes' ] > b[ 'output_bytes' ] * ( 1.0 + threshold ):
+            notes.append( 'output {} -> {} B'.format( b[ 'output_bytes' ], r[ 'output_bytes' ] ) )
+        if ( 'memory' in b ) and ( 'memory' in r ) and ( r[ 'memory' ][ 'total' ][ 'bytes' ] > b[ 'memory' ][ 'total' ][ 'bytes' ] * ( 1.0 + threshold ) ):
+            notes.append( 'heap {} -> {} B ({})'.format( b[ 'memory' ][ 'total' ][ 'bytes' ], r[ 'memory' ][ 'total' ][ 'bytes' ], ', '.join( '{} {:+d}'.format( s, m[ 'bytes' ] - b[ 'memory' ][ s ][ 'bytes' ] ) for s, m in sorted( r[ 'memory' ].items() ) if ( s != 'total' ) and ( s in b[ 'memory' ] ) and ( m[ 'bytes' ] != b[ 'memory' ][ s ][ 'bytes' ] ) ) ) )
+        if ( 'counters' in b ) and ( 'counters' in r ): # Informational: Cache and TLB miss changes show memory layout effects
+            changes = [ '{} {:+.1%}'.format( e, v / b[ 'counters' ][ 'total' ][ e ] - 1.0 ) for e, v in sorted( r[ 'counters' ][ 'total' ].items() ) if ( v is not None ) and b[ 'counters' ][ 'total' ].get( e ) ]
+            if changes: print( 'COUNTERS   {} {}: {}'.format( key[ 0 ], key[ 1 ], ', '.join( changes ) ), file = sys.stderr )
+        if notes:
+            n_regressions += 1
+            print( 'REGRESSION {} {}: {}'.format( key[ 0 ], key[ 1 ], '; '.join( notes ) ), file = sys.stderr )
+        else:
+            print( 'OK         {} {}: events/s {:+.1%}'.format( key[ 0 ], key[ 1 ], r[ 'events_per_s' ] / b[ 'events_per_s' ] - 1.0 if b[ 'events_per_s' ] > 0.0 else 0.0 ), file = sys.stderr )
+    print( '{} regression(s) at threshold {:.0%}'.format( n_regressions, threshold ), file = sys.stderr )
+    return n_regressions
+
+# Runner
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,201 @@
+#!/usr/bin/env python
+
+# QSS Solver Parallel Scaling Study
+#
+# Language: Python (2.7 or 3.x)
+#
+# Project: QSS Solver
+#
+# Developed by Objexx Engineering, Inc. (http://objexx.com)
+# under contract to the National Renewable Energy Laboratory
+# of the U.S. Department of Energy
+
+# Notes:
+# . Runs synthetic model families across sizes and --threads counts with the QSS executable using the QSS.perf.py case runner
+# . Reports wall time speedup and parallel efficiency against the 1 thread run of each model and size
+# . --counters adds the solver thread's task clock by phase (QSS_STATS builds): Work moved to the workers leaves the derivative and root phases
+# . Fan-out sweep: graph models with --par-fanout=1 and batching off so every requantization advances its observers in parallel
+# . Batch sweep: sync models with batching on and fan-out parallelism off so every simultaneous requantization is one parallel batch
+# . Recommends the smallest --par-fanout and --par-batch at and above which the best thread count is faster than serial by --margin
+# . Event counts must match the serial run: Parallel observer advances are deterministic
+# . Thresholds depend on the host: Rerun on the target machine before changing the option defaults
+# . Usage: QSS.scale.py [--qss=PATH] [--quick] [--threads=1,2,4] [--counters] [--repeat=N] [--margin=FRACTION] [--json=FILE]
+
+# Imports
+from __future__ import print_function
+import argparse, json, multiprocessing, os, platform, sys, time
+
+# Globals
+Method = 'QSS2'
+Args = [ '--rTol=1e-3', '--aTol=1e-4', '--out=' ] # No output: Output is serial
+Scaling = [ # ( family, sizes, quick sizes, extra arguments ): Family is formatted with the size
+ ( 'graph:{},fanout=64', [ 2000, 10000, 50000 ], [ 2000, 10000 ], [ '--tEnd=0.02' ] ),
+ ( 'sync:32x{},fanout=4', [ 2000, 10000, 50000 ], [ 2000, 10000 ], [ '--tEnd=0.2' ] ),
+]
+Fanouts = [ 4, 8, 16, 32, 64, 128, 256, 512 ] # Graph fan-out sweep
+Fanout_Model = ( 'graph:20000,fanout={}', [ '--tEnd=0.01' ] )
+Batches = [ 2, 4, 8, 16, 32, 64 ] # Sync simultaneous batch sweep
+Batch_Model = ( 'sync:{}x4000,fanout=2', [ '--tEnd=0.2' ] )
+Off = '1000000000' # Threshold that disables a parallel path
+
+# Main
+def main():
+
+    # Get options and arguments
+    n_cpu = multiprocessing.cpu_count()
+    parser = argparse.ArgumentParser( description = 'QSS solver parallel scaling study' )
+    parser.add_argument( '--qss', help = 'QSS executable [QSS]', default = 'QSS' )
+    parser.add_argument( '--quick', help = 'Run the smaller sizes and sweeps', action = 'store_true' )
+    parser.add_argument( '--threads', help = 'Comma-separated thread counts [1,2,4,...,CPUs]', default = ','.join( str( t ) for t in thread_counts( n_cpu ) ) )
+    parser.add_argument( '--repeat', help = 'Runs per case [1]', type = int, default = 1 )
+    parser.add_argument( '--counters', help = 'Collect solver thread task clock by phase (QSS_STATS builds)', action = 'store_true' )
+    parser.add_argument( '--margin', help = 'Speedup margin over serial for a threshold recommendation [0.05]', type = float, default = 0.05 )
+    parser.add_argument( '--json', help = 'Results JSON file [stdout]' )
+    arg = parser.parse_args()
+    perf = load_perf()
+    qss = perf.shutil.which( arg.qss ) if hasattr( perf.shutil, 'which' ) and perf.shutil.which( arg.qss ) else os.path.abspath( arg.qss )
+    if not os.path.isfile( qss ):
+        raise IOError( 'QSS executable not found: ' + str( arg.qss ) )
+    threads = sorted( set( [ 1 ] + [ int( t ) for t in arg.threads.split( ',' ) if t ] ) )
+    if threads[ 0 ] < 1: raise ValueError( 'Thread counts must be positive: ' + arg.threads )
+    if len( threads ) == 1: print( 'Only 1 thread: Speedups are all 1', file = sys.stderr )
+    if max( threads ) > n_cpu: print( 'Thread counts above the {} CPUs are oversubscribed'.format( n_cpu ), file = sys.stderr )
+    repeat = max( arg.repeat, 1 )
+    extra = [ '--counters' ] if arg.counters else []
+
+    # Scaling across sizes and thread counts
+    scaling = []
+    for family, sizes, quick_sizes, args in Scaling:
+        for size in ( quick_sizes if arg.quick else sizes ):
+            model = family.format( size )
+            scaling.append( sweep( perf, qss, model, args + extra, threads, [], repeat ) )
+    print_scaling( scaling, threads )
+    if arg.counters: print_phases( scaling, threads )
+
+    # Fan-out threshold sweep
+    fanouts = []
+    for fanout in ( Fanouts[ ::2 ] if arg.quick else Fanouts ):
+        fanouts.append( sweep( perf, qss, Fanout_Model[ 0 ].format( fanout ), Fanout_Model[ 1 ], threads, [ '--par-fanout=1', '--par-batch=' + Off ], repeat ) )
+        fanouts[ -1 ][ 'fanout' ] = fanout
+    par_fanout = threshold( fanouts, 'fanout', arg.margin )
+    print_sweep( 'Fan-out', fanouts, 'fanout', threads, par_fanout, '--par-fanout' )
+
+    # Simultaneous batch threshold sweep
+    batches = []
+    for batch in ( Batches[ ::2 ] if arg.quick else Batches ):
+        batches.append( sweep( perf, qss, Batch_Model[ 0 ].format( batch ), Batch_Model[ 1 ], threads, [ '--par-fanout=' + Off, '--par-batch=2' ], repeat ) )
+        batches[ -1 ][ 'batch' ] = batch
+    par_batch = threshold( batches, 'batch', arg.margin )
+    print_sweep( 'Batch', batches, 'batch', threads, par_batch, '--par-batch' )
+
+    # Write results
+    report = {
+     'version': 1,
+     'host': platform.node(),
+     'platform': platform.platform(),
+     'cpus': n_cpu,
+     'qss': qss,
+     'date': time.strftime( '%Y-%m-%dT%H:%M:%S' ),
+     'threads': threads,
+     'scaling': scaling,
+     'fanout_sweep': fanouts,
+     'batch_sweep': batches,
+     'recommended': { 'par_fanout': par_fanout, 'par_batch': par_batch }
+    }
+    if arg.json:
+        with open( arg.json, 'w' ) as json_file:
+            json.dump( report, json_file, indent = 1, sort_keys = True )
+    else:
+        print( json.dumps( report, indent = 1, sort_keys = True ) )
+
+# Load the Benchmark Suite Module for its Case Runner
+def load_perf():
+    path = os.path.join( os.path.dirname( os.path.abspath( __file__ ) ), 'QSS.perf.py' )
+    try:
+        import importlib.util
+        spec = importlib.util.spec_from_file_location( 'QSS_perf', path )
+        module = importlib.util.module_from_spec( spec )
+        spec.loader.exec_module( module )
+        return module
+    except ImportError: # Python 2
+        import imp
+        return imp.load_source( 'QSS_perf', path )
+
+# Default Thread Counts: Powers of 2 up to the CPU count and the CPU count
+def thread_counts( n_cpu ):
+    counts = [ 1 ]
+    while counts[ -1 ] * 2 <= n_cpu: counts.append( counts[ -1 ] * 2 )
+    if counts[ -1 ] != n_cpu: counts.append( n_cpu )
+    return counts
+
+# Run a Model at Each Thread Count: Returns { model, runs: [ { threads, wall_s, speedup, efficiency, ... } ] }
+def sweep( perf, qss, model, args, threads, parallel_args, repeat ):
+    runs = []
+    serial = None
+    for t in threads:
+        result = perf.run_case( qss, model, Method, Args + args + ( [ '--threads=' + str( t ) ] + parallel_args if t > 1 else [] ), repeat )
+        if serial is None:
+            serial = result
+        elif ( result[ 'requant_events' ] != serial[ 'requant_events' ] ) or ( result[ 'observer_advances' ] != serial[ 'observer_advances' ] ):
+            raise RuntimeError( 'Event counts differ from serial with {} threads: {}'.format( t, model ) )
+        run = {
+         'threads': t,
+         'wall_s': result[ 'wall_s' ],
+         'speedup': serial[ 'wall_s' ] / result[ 'wall_s' ] if result[ 'wall_s' ] > 0.0 else 0.0,
+         'requant_events': result[ 'requant_events' ],
+         'observer_advances': result[ 'observer_advances' ],
+         'peak_rss_kb': result[ 'peak_rss_kb' ]
+        }
+        run[ 'efficiency' ] = run[ 'speedup' ] / t
+        if 'counters' in result: run[ 'task_clock_ms' ] = phase_clock( result[ 'counters' ] )
+        runs.append( run )
+        print( '{:<32} {:>3} threads {:>9.3f} s {:>6.2f}x'.format( model, t, run[ 'wall_s' ], run[ 'speedup' ] ), file = sys.stderr )
+    return { 'model': model, 'args': Args + args, 'runs': runs }
+
+# Solver Thread Task Clock by Phase in ms: Returns { phase: ms } or None if Unsupported
+def phase_clock( counters ):
+    if counters.get( 'total', {} ).get( 'task_clock_ns' ) is None: return None
+    return dict( ( phase, events[ 'task_clock_ns' ] * 1.0e-6 ) for phase, events in counters.items() )
+
+# Smallest Sweep Value At and Above Which the Best Parallel Run Beats Serial by the Margin: Returns Value or None
+def threshold( cases, key, margin ):
+    best = None
+    for case in reversed( cases ): # Largest first
+        if max( [ run[ 'speedup' ] for run in case[ 'runs' ] if run[ 'threads' ] > 1 ] or [ 0.0 ] ) < 1.0 + margin: break
+        best = case[ key ]
+    return best
+
+# Print the Speedup and Efficiency Tables
+def print_scaling( scaling, threads ):
+    print( '\nSpeedup (efficiency) by thread count', file = sys.stderr )
+    print( '{:<32}'.format( 'model' ) + ''.join( '{:>16}'.format( '{} threads'.format( t ) ) for t in threads ), file = sys.stderr )
+    for case in scaling:
+        print( '{:<32}'.format( case[ 'model' ] ) + ''.join( '{:>16}'.format( '{:.2f}x ({:.0%})'.format( run[ 'speedup' ], run[ 'efficiency' ] ) ) for run in case[ 'runs' ] ), file = sys.stderr )
+
+# Print the Solver Thread Phase Breakdown
+def print_phases( scaling, threads ):
+    if not any( run.get( 'task_clock_ms' ) for case in scaling for run in case[ 'runs' ] ):
+        print( '\nNo phase breakdown: Task clock counters need a QSS_STATS build with perf_event_open access', file = sys.stderr )
+        return
+    phases = [ 'queue', 'derivative', 'root', 'output', 'other', 'total' ]
+    print( '\nSolver thread task clock by phase (ms)', file = sys.stderr )
+    print( '{:<32} {:>7}'.format( 'model', 'threads' ) + ''.join( '{:>12}'.format( p ) for p in phases ), file = sys.stderr )
+    for case in scaling:
+        for run in case[ 'runs' ]:
+            clock = run.get( 'task_clock_ms' )
+            if clock: print( '{:<32} {:>7}'.format( case[ 'model' ], run[ 'threads' ] ) + ''.join( '{:>12.1f}'.format( clock.get( p, 0.0 ) ) for p in phases ), file = sys.stderr )
+
+# Print a Threshold Sweep and its Recommendation
+def print_sweep( title, cases, key, threads, recommended, option ):
+    print( '\n{} sweep: Speedup by thread count'.format( title ), file = sys.stderr )
+    print( '{:>8}'.format( key ) + ''.join( '{:>12}'.format( '{} threads'.format( t ) ) for t in threads ), file = sys.stderr )
+    for case in cases:
+        print( '{:>8}'.format( case[ key ] ) + ''.join( '{:>12}'.format( '{:.2f}x'.format( run[ 'speedup' ] ) ) for run in case[ 'runs' ] ), file = sys.stderr )
+    if recommended is None:
+        print( 'Recommended: No parallel payoff in the sweep: Keep {} above {}'.format( option, cases[ -1 ][ key ] if cases else 0 ), file = sys.stderr )
+    else:
+        print( 'Recommended: {}={}'.format( option, recommended ), file = sys.stderr )
+
+# Runner
+if __name__ == '__main__':
+    main()
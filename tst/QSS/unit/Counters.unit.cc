@@ -0,0 +1,67 @@
+// QSS::Counters Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Counters.hh>
+
+// C++ Headers
+#include <cmath>
+#include <sstream>
+#include <string>
+
+using namespace counters;
+
+TEST( CountersTest, Attribution )
+{
+	Counts c;
+	c.supported[ Cycles ] = true;
+	c.total[ Cycles ] = 1000.0;
+	c.samples[ Queue ][ Cycles ] = 1u;
+	c.samples[ Derivative ][ Cycles ] = 3u;
+	EXPECT_DOUBLE_EQ( 250.0, c( Queue, Cycles ) );
+	EXPECT_DOUBLE_EQ( 750.0, c( Derivative, Cycles ) );
+	EXPECT_DOUBLE_EQ( 0.0, c( Root, Cycles ) );
+	c.total[ LLC_Misses ] = 5.0; // Too few for a sample
+	EXPECT_DOUBLE_EQ( 5.0, c( Other, LLC_Misses ) );
+	EXPECT_DOUBLE_EQ( 0.0, c( Queue, LLC_Misses ) );
+	std::ostringstream stream;
+	report( c, stream );
+	std::string const text( stream.str() );
+	EXPECT_NE( std::string::npos, text.find( "derivative" ) );
+	EXPECT_NE( std::string::npos, text.find( "n/a" ) ); // Unsupported counters
+}
+
+#ifdef QSS_STATS
+TEST( CountersTest, Scope )
+{
+	EXPECT_EQ( Other, phase );
+	{
+		Scope const outer( Derivative );
+		EXPECT_EQ( Derivative, phase );
+		{
+			Scope const inner( Root );
+			EXPECT_EQ( Root, phase );
+		}
+		EXPECT_EQ( Derivative, phase );
+	}
+	EXPECT_EQ( Other, phase );
+}
+
+TEST( CountersTest, Sampling )
+{
+	if ( ! start() ) return; // Counters not permitted here
+	double s( 0.0 );
+	{
+		Scope const scope( Derivative );
+		for ( int i = 1; i < 20000000; ++i ) s += std::sqrt( double( i ) );
+	}
+	Counts const c( stop() );
+	EXPECT_GT( s, 0.0 );
+	if ( c.supported[ Task_Clock ] ) {
+		EXPECT_GT( c.total[ Task_Clock ], 0.0 );
+		EXPECT_GT( c( Derivative, Task_Clock ), c( Other, Task_Clock ) ); // Nearly all samples in the busy phase
+	}
+}
+#endif
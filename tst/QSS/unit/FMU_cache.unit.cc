@@ -0,0 +1,87 @@
+// QSS::FMU_cache Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/FMU_cache.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace {
+
+// Write a File
+void
+write_file( std::string const & file_name, std::string const & contents )
+{
+	std::ofstream stream( file_name, std::ios_base::binary | std::ios_base::out );
+	stream << contents;
+}
+
+} // Internal
+
+TEST( FMU_cacheTest, Tables )
+{
+	FMU::Tables tables;
+	tables.n_fmu_vars = 6u;
+	tables.reals = { 0u, 1u, 2u, 3u };
+	tables.outs = { 0u, 5u };
+	tables.ders = { 1u, FMU::Tables::none, 3u };
+	tables.states = { 0u, FMU::Tables::none, 2u };
+	tables.has_deps = true;
+	tables.dep_start = { 0u, 2u, 2u, 3u };
+	tables.deps = { 1u, 3u, 1u };
+	tables.dep_kinds = { 0, 1, 2 };
+	std::string const file_name( "FMU_cache.unit.qss_tables" );
+	ASSERT_TRUE( FMU::write_tables( file_name, tables ) );
+	{
+		FMU::Mapped_Tables mapped;
+		FMU::Tables_View view;
+		ASSERT_TRUE( mapped.open( file_name, view ) );
+		EXPECT_EQ( 6u, view.n_fmu_vars );
+		ASSERT_EQ( 4u, view.n_reals );
+		ASSERT_EQ( 2u, view.n_outs );
+		ASSERT_EQ( 3u, view.n_ders );
+		EXPECT_TRUE( view.has_deps );
+		ASSERT_EQ( 3u, view.n_deps );
+		EXPECT_EQ( 3u, view.reals[ 3 ] );
+		EXPECT_EQ( 5u, view.outs[ 1 ] );
+		EXPECT_EQ( FMU::Tables::none, view.ders[ 1 ] );
+		EXPECT_EQ( 2u, view.states[ 2 ] );
+		EXPECT_EQ( 3u, view.dep_start[ 3 ] );
+		EXPECT_EQ( 3u, view.deps[ 1 ] );
+		EXPECT_EQ( 2, view.dep_kinds[ 2 ] );
+	}
+	{ // Truncated file is rejected
+		std::ifstream in( file_name, std::ios_base::binary );
+		std::string const contents( ( std::istreambuf_iterator< char >( in ) ), std::istreambuf_iterator< char >() );
+		in.close();
+		write_file( file_name, contents.substr( 0u, contents.size() - 1u ) );
+		FMU::Mapped_Tables mapped;
+		FMU::Tables_View view;
+		EXPECT_FALSE( mapped.open( file_name, view ) );
+	}
+	std::remove( file_name.c_str() );
+	FMU::Mapped_Tables mapped;
+	FMU::Tables_View view;
+	EXPECT_FALSE( mapped.open( file_name, view ) ); // Absent
+}
+
+TEST( FMU_cacheTest, Key )
+{
+	std::string const file_name( "FMU_cache.unit.fmu" );
+	std::string big( 200000u, 'a' );
+	write_file( file_name, big );
+	std::string const key( FMU::cache_key( file_name ) );
+	EXPECT_EQ( 16u, key.length() );
+	EXPECT_EQ( key, FMU::cache_key( file_name ) );
+	big[ big.size() - 10u ] = 'b'; // Tail change: Zip central directory
+	write_file( file_name, big );
+	EXPECT_NE( key, FMU::cache_key( file_name ) );
+	std::remove( file_name.c_str() );
+	EXPECT_TRUE( FMU::cache_key( file_name ).empty() );
+}
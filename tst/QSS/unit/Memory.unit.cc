@@ -0,0 +1,67 @@
+// QSS::Memory Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Memory.hh>
+#include <QSS/Function_LTI.hh>
+#include <QSS/Variable_QSS1.hh>
+
+// C++ Headers
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST( MemoryTest, Block )
+{
+	EXPECT_EQ( 0u, Memory::block( 0u ) );
+	EXPECT_EQ( 32u, Memory::block( 1u ) );
+	EXPECT_EQ( 32u, Memory::block( 24u ) );
+	EXPECT_EQ( 48u, Memory::block( 25u ) );
+	EXPECT_EQ( 112u, Memory::block( 100u ) );
+}
+
+TEST( MemoryTest, Containers )
+{
+	std::vector< double > v;
+	EXPECT_EQ( 0u, Memory::heap( v ) );
+	v.reserve( 10u );
+	EXPECT_EQ( Memory::block( v.capacity() * sizeof( double ) ), Memory::heap( v ) );
+	EXPECT_EQ( 0u, Memory::heap( std::string( "x" ) ) ); // Short string
+	std::string const s( 100u, 'x' );
+	EXPECT_EQ( Memory::block( s.capacity() + 1u ), Memory::heap( s ) );
+	std::vector< std::string > const names{ "x", s };
+	EXPECT_EQ( Memory::block( names.capacity() * sizeof( std::string ) ) + Memory::heap( s ), Memory::heap( names ) );
+}
+
+TEST( MemoryTest, Variables )
+{
+	Variable_QSS1< Function_LTI > x1( "x1" );
+	Variable_QSS1< Function_LTI > x2( "x2" );
+	x1.d().add( 1.0 ).add( 2.0, x2 );
+	x2.d().add( 3.0, x1 );
+	x1.add_observer( x2 );
+	x2.add_observer( x1 );
+	Memory m;
+	m.n_variables = 2u;
+	m.n_edges = 2u;
+	x1.memory( m );
+	x2.memory( m );
+	EXPECT_EQ( 2u * Memory::block( sizeof( x1 ) ), m.bytes[ Memory::Variables ] );
+	EXPECT_EQ( 0u, m.bytes[ Memory::Names ] ); // Short names
+	EXPECT_EQ( Memory::heap( x1.observers() ) + Memory::heap( x2.observers() ), m.bytes[ Memory::Observers ] );
+	EXPECT_EQ( x1.d().heap_bytes() + x2.d().heap_bytes(), m.bytes[ Memory::Functions ] );
+	EXPECT_LT( 0u, m.bytes[ Memory::Functions ] );
+	EXPECT_EQ( 0u, m.bytes[ Memory::Event_Queue ] );
+	EXPECT_EQ( m.bytes[ Memory::Variables ] + m.bytes[ Memory::Observers ] + m.bytes[ Memory::Functions ], m.total() );
+
+	std::ostringstream stream;
+	memory_summary( m, stream );
+	memory_report( m, stream );
+	std::string const text( stream.str() );
+	EXPECT_NE( std::string::npos, text.find( "2 variables and 2 observer edges" ) );
+	EXPECT_NE( std::string::npos, text.find( "event_queue" ) );
+	EXPECT_NE( std::string::npos, text.find( "total" ) );
+	EXPECT_STREQ( "functions", memory_name( Memory::Functions ) );
+}
@@ -0,0 +1,121 @@
+// QSS::Model_File Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Model_File.hh>
+#include <QSS/Function_LTI.hh>
+#include <QSS/options.hh>
+#include <QSS/Variable_QSS.hh>
+
+// C++ Headers
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Variables = std::vector< Variable * >;
+using V = Variable_QSS< Function_LTI >;
+
+// Write a Text Model File
+void
+write_text( std::string const & file_name, std::string const & text )
+{
+	std::ofstream stream( file_name, std::ios_base::binary | std::ios_base::out );
+	stream << text;
+}
+
+// Test Model Text: Forward reference, repeated term, constant, input, and comments
+std::string const text(
+ "# Test model\n"
+ "qss QSS3\n"
+ "var x xIni=2 rTol=1e-3 # Comment\n"
+ "der x -1*x 0.5*y 0.25*y u 3\n"
+ "var y xIni=4 qss=LIQSS1 dtMax=0.5\n"
+ "der y -x\n"
+ "\n"
+ "inp u sin c=0.05 s=0.5 dtMax=0.1\n"
+);
+
+// Derivative of Variable i at Initial Values
+double
+d0( Variables const & vars, std::size_t const i )
+{
+	return static_cast< V * >( vars[ i ] )->d().x( 0.0 );
+}
+
+// Delete Variables
+void
+clear( Variables & vars )
+{
+	for ( auto var : vars ) delete var;
+	vars.clear();
+}
+
+}
+
+TEST( Model_FileTest, Text )
+{
+	std::string const file_name( "Model_File.unit.qsm" );
+	write_text( file_name, text );
+	Model_Description model;
+	ASSERT_TRUE( read_model_text( file_name, model ) );
+	ASSERT_EQ( 3u, model.vars.size() );
+	EXPECT_EQ( "xyu", model.names );
+	EXPECT_EQ( 3u, model.vars[ 0 ].method ); // QSS3
+	EXPECT_EQ( 4u, model.vars[ 1 ].method ); // LIQSS1
+	EXPECT_EQ( Model_Description::Input, model.vars[ 2 ].type );
+	EXPECT_DOUBLE_EQ( 3.0, model.vars[ 0 ].c0 );
+	EXPECT_TRUE( std::isnan( model.vars[ 1 ].rTol ) );
+	EXPECT_EQ( ( std::vector< std::uint64_t >{ 0u, 3u, 4u, 4u } ), model.row_ptr );
+	EXPECT_EQ( ( std::vector< std::uint32_t >{ 0u, 1u, 2u, 0u } ), model.col );
+	EXPECT_EQ( ( std::vector< double >{ -1.0, 0.75, 1.0, -1.0 } ), model.val ); // Repeated y terms merged
+	std::remove( file_name.c_str() );
+}
+
+TEST( Model_FileTest, TextErrors )
+{
+	std::string const file_name( "Model_File.unit.qsm" );
+	Model_Description model;
+	write_text( file_name, "var x\nder x 2*z\n" );
+	EXPECT_FALSE( read_model_text( file_name, model ) ); // Undeclared variable
+	write_text( file_name, "var x\nvar x\n" );
+	EXPECT_FALSE( read_model_text( file_name, model ) ); // Duplicate variable
+	write_text( file_name, "inp u sin\nder u 1\n" );
+	EXPECT_FALSE( read_model_text( file_name, model ) ); // Input derivative
+	write_text( file_name, "var x qss=QSS9\n" );
+	EXPECT_FALSE( read_model_text( file_name, model ) ); // Unknown method
+	std::remove( file_name.c_str() );
+}
+
+TEST( Model_FileTest, Load )
+{
+	std::string const file_name( "Model_File.unit.qsm" );
+	std::string const binary_name( file_name + 'b' );
+	write_text( file_name, text );
+	ASSERT_TRUE( model_text_to_binary( file_name ) );
+	EXPECT_TRUE( is_model_file( file_name ) );
+	EXPECT_TRUE( is_model_file( binary_name ) );
+	EXPECT_FALSE( is_model_file( "xyz" ) );
+	for ( std::string const & name : { file_name, binary_name } ) { // Both forms build the same variables
+		Variables vars;
+		load_model_file( name, vars );
+		ASSERT_EQ( 3u, vars.size() );
+		EXPECT_EQ( "x", vars[ 0 ]->name );
+		EXPECT_EQ( "u", vars[ 2 ]->name );
+		EXPECT_EQ( 3, vars[ 0 ]->order() );
+		EXPECT_EQ( 1, vars[ 1 ]->order() );
+		EXPECT_DOUBLE_EQ( 1.0e-3, vars[ 0 ]->rTol );
+		EXPECT_DOUBLE_EQ( options::rTol, vars[ 1 ]->rTol );
+		EXPECT_DOUBLE_EQ( 0.5, vars[ 1 ]->dt_max );
+		EXPECT_DOUBLE_EQ( 0.1, vars[ 2 ]->dt_max );
+		EXPECT_DOUBLE_EQ( -2.0, d0( vars, 1u ) );
+		clear( vars );
+	}
+	std::remove( file_name.c_str() );
+	std::remove( binary_name.c_str() );
+}
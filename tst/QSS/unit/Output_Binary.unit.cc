@@ -0,0 +1,91 @@
+// QSS::Output_Binary Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Output_Binary.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <string>
+
+TEST( Output_BinaryTest, RoundTrip )
+{
+	std::string const file_name( "Output_Binary.unit.qss" );
+	{
+		Output_Binary_Writer writer( file_name, 4u ); // Small blocks to exercise multiple blocks per channel
+		EXPECT_TRUE( writer.is_open() );
+		EXPECT_EQ( 0u, writer.add( "x1", 'x' ) );
+		EXPECT_EQ( 1u, writer.add( "x1", 'q' ) );
+		EXPECT_EQ( 2u, writer.add( "empty", 'f' ) );
+		EXPECT_EQ( 3u, writer.size() );
+		for ( int i = 0; i < 10; ++i ) {
+			writer.put( 0u, 0.1 * i, 2.0 * i );
+			if ( i % 3 == 0 ) writer.put( 1u, 0.1 * i, -1.0 * i );
+		}
+	} // Writer closes on destruction
+
+	Output_Binary_Reader reader( file_name );
+	ASSERT_TRUE( reader.good() );
+	EXPECT_EQ( 3u, reader.size() );
+	EXPECT_EQ( "x1", reader.name( 0u ) );
+	EXPECT_EQ( 'x', reader.kind( 0u ) );
+	EXPECT_EQ( 'q', reader.kind( 1u ) );
+	EXPECT_EQ( 10u, reader.n_records( 0u ) );
+	EXPECT_EQ( 4u, reader.n_records( 1u ) );
+	EXPECT_EQ( 0u, reader.n_records( 2u ) );
+	EXPECT_EQ( 1u, reader.find( "x1", 'q' ) );
+	EXPECT_EQ( reader.size(), reader.find( "x2", 'x' ) );
+
+	Output_Binary_Reader::Times t;
+	Output_Binary_Reader::Values v;
+	ASSERT_TRUE( reader.read( 0u, t, v ) );
+	ASSERT_EQ( 10u, t.size() );
+	for ( int i = 0; i < 10; ++i ) {
+		EXPECT_EQ( 0.1 * i, t[ i ] );
+		EXPECT_EQ( 2.0 * i, v[ i ] );
+	}
+	ASSERT_TRUE( reader.read( 1u, t, v ) );
+	ASSERT_EQ( 4u, t.size() );
+	EXPECT_EQ( 0.9, t[ 3 ] );
+	EXPECT_EQ( -9.0, v[ 3 ] );
+	ASSERT_TRUE( reader.read( 2u, t, v ) );
+	EXPECT_TRUE( t.empty() );
+
+	std::remove( file_name.c_str() );
+}
+
+TEST( Output_BinaryTest, Compressed )
+{
+	std::string const file_name( "Output_Binary.unit.compressed.qss" );
+	{
+		Output_Binary_Writer writer( file_name, 64u, true );
+		EXPECT_TRUE( writer.is_open() );
+		EXPECT_EQ( 0u, writer.add( "x1", 'x' ) );
+		for ( int i = 0; i < 200; ++i ) {
+			writer.put( 0u, 0.001 * i * i, ( i < 100 ? 1.5 : 1.5 - 0.25 * i ) );
+		}
+	}
+
+	Output_Binary_Reader reader( file_name );
+	ASSERT_TRUE( reader.good() );
+	EXPECT_TRUE( reader.compressed() );
+	EXPECT_EQ( 200u, reader.n_records( 0u ) );
+	Output_Binary_Reader::Times t;
+	Output_Binary_Reader::Values v;
+	ASSERT_TRUE( reader.read( 0u, t, v ) );
+	ASSERT_EQ( 200u, t.size() );
+	for ( int i = 0; i < 200; ++i ) {
+		EXPECT_EQ( 0.001 * i * i, t[ i ] );
+		EXPECT_EQ( ( i < 100 ? 1.5 : 1.5 - 0.25 * i ), v[ i ] );
+	}
+
+	std::remove( file_name.c_str() );
+}
+
+TEST( Output_BinaryTest, Name )
+{
+	EXPECT_EQ( "achilles.qss", output_binary_name( "achilles" ) );
+	EXPECT_EQ( "model.qss", output_binary_name( "dir/sub/model.fmu" ) );
+}
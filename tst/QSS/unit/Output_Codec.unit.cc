@@ -0,0 +1,87 @@
+// QSS::Output_Codec Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Output_Codec.hh>
+
+// C++ Headers
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace {
+
+// Encode and Decode a Block and Check Bitwise Round Trip
+void
+round_trip( std::vector< double > const & t, std::vector< double > const & v, std::size_t & n_bytes )
+{
+	ASSERT_EQ( t.size(), v.size() );
+	std::size_t const n( t.size() );
+	std::vector< std::uint8_t > bytes;
+	encode_block( t.data(), v.data(), n, bytes );
+	n_bytes = bytes.size();
+	std::vector< double > t_( n ), v_( n );
+	ASSERT_TRUE( decode_block( bytes.data(), bytes.size(), n, t_.data(), v_.data() ) );
+	for ( std::size_t i = 0; i < n; ++i ) {
+		EXPECT_EQ( 0, std::memcmp( &t[ i ], &t_[ i ], sizeof( double ) ) );
+		EXPECT_EQ( 0, std::memcmp( &v[ i ], &v_[ i ], sizeof( double ) ) );
+	}
+}
+
+}
+
+TEST( Output_CodecTest, Regular )
+{
+	std::vector< double > t, v;
+	for ( int i = 0; i < 256; ++i ) {
+		t.push_back( 0.5 * i );
+		v.push_back( 3.0 );
+	}
+	std::size_t n_bytes( 0u );
+	round_trip( t, v, n_bytes );
+	EXPECT_LT( n_bytes, 256u * 16u / 8u ); // Constant values and near-regular times compress well
+}
+
+TEST( Output_CodecTest, Irregular )
+{
+	std::vector< double > t, v;
+	double ti( 0.0 );
+	for ( int i = 0; i < 500; ++i ) {
+		ti += 1.0e-3 * ( 1 + ( ( i * 7919 ) % 13 ) );
+		t.push_back( ti );
+		v.push_back( std::sin( ti ) * 1.0e3 );
+	}
+	t.push_back( ti ); // Repeated time
+	v.push_back( v.back() );
+	t.push_back( 1.0e300 ); // Huge jump
+	v.push_back( -v.back() );
+	std::size_t n_bytes( 0u );
+	round_trip( t, v, n_bytes );
+	EXPECT_LT( n_bytes, t.size() * 16u );
+}
+
+TEST( Output_CodecTest, Special )
+{
+	double const inf( std::numeric_limits< double >::infinity() );
+	double const nan( std::numeric_limits< double >::quiet_NaN() );
+	double const den( std::numeric_limits< double >::denorm_min() );
+	std::vector< double > t{ 0.0, 0.0, den, 1.0, 2.0, inf };
+	std::vector< double > v{ -0.0, 0.0, nan, -inf, inf, den };
+	std::size_t n_bytes( 0u );
+	round_trip( t, v, n_bytes );
+	std::vector< double > t1{ 42.0 }, v1{ -1.0 };
+	round_trip( t1, v1, n_bytes );
+	EXPECT_EQ( 16u, n_bytes );
+}
+
+TEST( Output_CodecTest, Truncated )
+{
+	std::vector< double > t{ 0.0, 0.1, 0.3, 0.7 }, v{ 1.0, 2.0, 4.0, 8.0 };
+	std::vector< std::uint8_t > bytes;
+	encode_block( t.data(), v.data(), t.size(), bytes );
+	std::vector< double > t_( t.size() ), v_( v.size() );
+	EXPECT_FALSE( decode_block( bytes.data(), bytes.size() - 4u, t.size(), t_.data(), v_.data() ) );
+}
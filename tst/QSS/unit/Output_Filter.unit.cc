@@ -0,0 +1,62 @@
+// QSS::Output_Filter Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Output_Filter.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+TEST( Output_FilterTest, Glob )
+{
+	EXPECT_TRUE( Output_Filter::glob_match( "*", "" ) );
+	EXPECT_TRUE( Output_Filter::glob_match( "x*", "x12" ) );
+	EXPECT_TRUE( Output_Filter::glob_match( "x?", "x1" ) );
+	EXPECT_FALSE( Output_Filter::glob_match( "x?", "x12" ) );
+	EXPECT_TRUE( Output_Filter::glob_match( "*.T*", "room.wall.T[3]" ) );
+	EXPECT_TRUE( Output_Filter::glob_match( "a*b*c", "aXbYbc" ) );
+	EXPECT_FALSE( Output_Filter::glob_match( "a*b*c", "aXbYbcd" ) );
+	EXPECT_TRUE( Output_Filter::glob_match( "x[1]", "x[1]" ) ); // Brackets are literal: Modelica array element names
+}
+
+TEST( Output_FilterTest, Selection )
+{
+	Output_Filter all;
+	EXPECT_TRUE( all.all() );
+	EXPECT_TRUE( all.selected( "anything" ) );
+
+	Output_Filter filter;
+	EXPECT_TRUE( filter.add_pattern( "x*" ) );
+	EXPECT_TRUE( filter.add_pattern( "re:y[0-9]+" ) );
+	EXPECT_FALSE( filter.add_pattern( "re:(" ) );
+	EXPECT_FALSE( filter.all() );
+	EXPECT_TRUE( filter.selected( "x1" ) );
+	EXPECT_TRUE( filter.selected( "y42" ) );
+	EXPECT_FALSE( filter.selected( "y4a" ) ); // Regex matches whole name
+	EXPECT_FALSE( filter.selected( "z" ) );
+
+	filter.add_causality( "output" );
+	EXPECT_TRUE( filter.selected( "x1", "output" ) );
+	EXPECT_FALSE( filter.selected( "x1", "local" ) );
+	EXPECT_TRUE( filter.selected( "x1" ) ); // No causality: Not an FMU variable
+}
+
+TEST( Output_FilterTest, File )
+{
+	std::string const file_name( "Output_Filter.unit.txt" );
+	{
+		std::ofstream stream( file_name );
+		stream << "# Output variables\n\n  a.b  \nre:c[0-9]\n";
+	}
+	Output_Filter filter;
+	EXPECT_TRUE( filter.add_file( file_name ) );
+	EXPECT_TRUE( filter.selected( "a.b" ) );
+	EXPECT_TRUE( filter.selected( "c7" ) );
+	EXPECT_FALSE( filter.selected( "# Output variables" ) );
+	std::remove( file_name.c_str() );
+	EXPECT_FALSE( Output_Filter().add_file( file_name ) );
+}
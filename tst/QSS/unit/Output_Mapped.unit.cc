@@ -0,0 +1,64 @@
+// QSS::Output_Mapped Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Output_Mapped.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <string>
+
+TEST( Output_MappedTest, RoundTrip )
+{
+	std::string const file_name( "Output_Mapped.unit.qssm" );
+	std::string const long_name( "a.very.long.variable.name.spanning.name.records" );
+	{
+		Output_Mapped_Writer writer( file_name, 4096u ); // Small chunks to exercise chunk growth
+		ASSERT_TRUE( writer.is_open() );
+		EXPECT_EQ( 0u, writer.add( "x1", 'x' ) );
+		EXPECT_EQ( 1u, writer.add( long_name, 'q' ) );
+		EXPECT_EQ( 2u, writer.add( "empty", 'f' ) );
+		EXPECT_EQ( 3u, writer.size() );
+		for ( int i = 0; i < 1000; ++i ) {
+			writer.put( 0u, 0.1 * i, 2.0 * i );
+			if ( i % 3 == 0 ) writer.put( 1u, 0.1 * i, -1.0 * i );
+		}
+
+		Output_Mapped_Reader partial( file_name ); // Still open: Only complete chunks are readable
+		ASSERT_TRUE( partial.good() );
+		EXPECT_FALSE( partial.complete() );
+		EXPECT_EQ( 3u, partial.size() );
+		EXPECT_LT( partial.n_records( 0u ), 1000u );
+		EXPECT_GT( partial.n_records( 0u ), 0u );
+		EXPECT_EQ( 2.0, partial.v( 0u )[ 1 ] );
+	} // Writer closes on destruction
+
+	Output_Mapped_Reader reader( file_name );
+	ASSERT_TRUE( reader.good() );
+	EXPECT_TRUE( reader.complete() );
+	EXPECT_EQ( 3u, reader.size() );
+	EXPECT_EQ( "x1", reader.name( 0u ) );
+	EXPECT_EQ( long_name, reader.name( 1u ) );
+	EXPECT_EQ( 'q', reader.kind( 1u ) );
+	EXPECT_EQ( 'f', reader.kind( 2u ) );
+	EXPECT_EQ( 1u, reader.find( long_name, 'q' ) );
+	EXPECT_EQ( reader.size(), reader.find( "x1", 'q' ) );
+	ASSERT_EQ( 1000u, reader.n_records( 0u ) );
+	ASSERT_EQ( 334u, reader.n_records( 1u ) );
+	EXPECT_EQ( 0u, reader.n_records( 2u ) );
+	for ( int i = 0; i < 1000; ++i ) {
+		EXPECT_EQ( 0.1 * i, reader.t( 0u )[ i ] );
+		EXPECT_EQ( 2.0 * i, reader.v( 0u )[ i ] );
+	}
+	EXPECT_EQ( -999.0, reader.v( 1u ).back() );
+
+	std::remove( file_name.c_str() );
+}
+
+TEST( Output_MappedTest, Name )
+{
+	EXPECT_EQ( "achilles.qssm", output_mapped_name( "achilles" ) );
+	EXPECT_EQ( "model.qssm", output_mapped_name( "dir/sub/model.fmu" ) );
+}
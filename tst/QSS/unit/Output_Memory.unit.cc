@@ -0,0 +1,47 @@
+// QSS::Output_Memory Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Output.hh>
+#include <QSS/Output_Memory.hh>
+
+TEST( Output_MemoryTest, Basic )
+{
+	Output_Memory memory;
+	EXPECT_EQ( 0u, memory.add( "x1", 'x' ) );
+	EXPECT_EQ( 1u, memory.add( "x1", 'q' ) );
+	EXPECT_EQ( 2u, memory.size() );
+	for ( int i = 0; i < 5; ++i ) memory.put( 0u, 0.5 * i, -1.0 * i );
+	memory.put( 1u, 1.0, 7.0 );
+	memory.shrink();
+	EXPECT_EQ( "x1", memory.name( 1u ) );
+	EXPECT_EQ( 'q', memory.kind( 1u ) );
+	EXPECT_EQ( 1u, memory.find( "x1", 'q' ) );
+	EXPECT_EQ( memory.size(), memory.find( "x2", 'x' ) );
+	ASSERT_EQ( 5u, memory.n_records( 0u ) );
+	double const * t( memory.t( 0u ).data() ); // Contiguous arrays
+	double const * v( memory.v( 0u ).data() );
+	for ( int i = 0; i < 5; ++i ) {
+		EXPECT_EQ( 0.5 * i, t[ i ] );
+		EXPECT_EQ( -1.0 * i, v[ i ] );
+	}
+	EXPECT_EQ( 7.0, memory.v( 1u )[ 0 ] );
+}
+
+TEST( Output_MemoryTest, Output )
+{
+	Output_Memory memory;
+	Output x_out( 'x', &memory );
+	x_out.add( "a" );
+	x_out.add( "b" );
+	x_out( 1u, 0.0, 2.0 );
+	x_out.requant( 1u, 1.0, 3.0 );
+	x_out.close( 1u );
+	EXPECT_EQ( 2u, x_out.size() );
+	EXPECT_EQ( 'x', memory.kind( 0u ) );
+	EXPECT_EQ( 0u, memory.n_records( 0u ) );
+	ASSERT_EQ( 2u, memory.n_records( 1u ) );
+	EXPECT_EQ( 3.0, memory.v( 1u )[ 1 ] );
+}
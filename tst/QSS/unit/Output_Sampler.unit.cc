@@ -0,0 +1,42 @@
+// QSS::Output_Sampler Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Function_LTI.hh>
+#include <QSS/Output_Sampler.hh>
+#include <QSS/Variable_QSS2.hh>
+#include <QSS/Variable_QSS3.hh>
+
+TEST( Output_SamplerTest, Basic )
+{
+	Variable_QSS2< Function_LTI > x1( "x1" );
+	x1.d().add( 12.0 ).add( 2.0, x1 );
+	x1.init( 2.5 );
+	Variable_QSS3< Function_LTI > x2( "x2" );
+	x2.d().add( -1.0 ).add( 0.5, x2 );
+	x2.init( 1.0 );
+	Variable::Variables const vars{ &x1, &x2 };
+
+	Output_Sampler sampler( vars, true, true );
+	EXPECT_EQ( 2u, sampler.size() );
+	double const t1( 0.5 * x1.tE );
+	sampler.sample( t1 );
+	EXPECT_EQ( x1.x( t1 ), sampler.x( 0u ) );
+	EXPECT_EQ( x1.q( t1 ), sampler.q( 0u ) );
+	EXPECT_EQ( x2.x( t1 ), sampler.x( 1u ) );
+	EXPECT_EQ( x2.q( t1 ), sampler.q( 1u ) );
+
+	x1.advance(); // Requantize x1
+	sampler.changed( 0u );
+	double const t2( x1.tQ + 0.25 * ( x1.tE - x1.tQ ) );
+	ASSERT_TRUE( t2 <= x2.tE );
+	sampler.sample( t2 );
+	EXPECT_EQ( x1.x( t2 ), sampler.x( 0u ) );
+	EXPECT_EQ( x1.q( t2 ), sampler.q( 0u ) );
+	EXPECT_EQ( x2.x( t2 ), sampler.x( 1u ) );
+	EXPECT_EQ( x2.q( t2 ), sampler.q( 1u ) );
+
+	events.clear();
+}
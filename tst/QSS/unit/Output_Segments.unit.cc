@@ -0,0 +1,79 @@
+// QSS::Output_Segments Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Output_Segments.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <string>
+
+TEST( Output_SegmentsTest, RoundTrip )
+{
+	std::string const file_name( "Output_Segments.unit.seg" );
+	{
+		Output_Segments_Writer writer( file_name );
+		EXPECT_TRUE( writer.is_open() );
+		EXPECT_EQ( 0u, writer.add( "x" ) );
+		EXPECT_EQ( 1u, writer.add( "y" ) );
+		EXPECT_EQ( 2u, writer.size() );
+		double const c1[] = { 1.0, 2.0, 3.0, 4.0 };
+		double const c2[] = { 5.0, -1.0 };
+		double const c3[] = { 7.0, 0.5, 0.25 };
+		writer.put( 0u, 0.0, 3, c1 );
+		writer.put( 1u, 0.0, 0, c2 );
+		writer.put( 0u, 1.0, 1, c2 );
+		writer.put( 1u, 1.0, 1, c2 ); // Replaced by next segment at the same time
+		writer.put( 1u, 1.0, 2, c3 );
+		writer.close( 2.0 );
+	}
+
+	Output_Segments_Reader reader( file_name );
+	ASSERT_TRUE( reader.good() );
+	EXPECT_EQ( 2u, reader.size() );
+	EXPECT_EQ( "y", reader.name( 1u ) );
+	EXPECT_EQ( 1u, reader.find( "y" ) );
+	EXPECT_EQ( reader.size(), reader.find( "z" ) );
+	EXPECT_EQ( 0.0, reader.tBeg() );
+	EXPECT_EQ( 2.0, reader.tEnd() );
+	EXPECT_EQ( 2u, reader.segments( 0u ).size() );
+	EXPECT_EQ( 2u, reader.segments( 1u ).size() );
+	EXPECT_EQ( 2, reader.segments( 1u ).back().order );
+
+	EXPECT_DOUBLE_EQ( 1.0, reader.x( 0u, 0.0 ) );
+	EXPECT_DOUBLE_EQ( 1.0 + 1.0 + 0.75 + 0.5, reader.x( 0u, 0.5 ) ); // Cubic segment
+	EXPECT_DOUBLE_EQ( 5.0, reader.x( 0u, 1.0 ) );
+	EXPECT_DOUBLE_EQ( 4.5, reader.x( 0u, 1.5 ) );
+	EXPECT_DOUBLE_EQ( 5.0, reader.x( 1u, 0.5 ) ); // Constant segment
+	EXPECT_DOUBLE_EQ( 7.0 + 0.5 + 0.25, reader.x( 1u, 2.0 ) );
+
+	Output_Segments_Reader::Times const t{ 0.0, 0.5, 1.0, 1.5, 2.0 };
+	Output_Segments_Reader::Values v;
+	reader.x( 0u, t, v );
+	ASSERT_EQ( t.size(), v.size() );
+	for ( std::size_t k = 0; k < t.size(); ++k ) {
+		EXPECT_DOUBLE_EQ( reader.x( 0u, t[ k ] ), v[ k ] );
+	}
+
+	std::remove( file_name.c_str() );
+}
+
+TEST( Output_SegmentsTest, Unclosed )
+{
+	std::string const file_name( "Output_Segments.unit.open.seg" );
+	{
+		std::FILE * f( std::fopen( file_name.c_str(), "wb" ) );
+		std::fputs( "QSSP", f ); // Preamble without trailer
+		std::fclose( f );
+	}
+	EXPECT_FALSE( Output_Segments_Reader( file_name ).good() );
+	std::remove( file_name.c_str() );
+}
+
+TEST( Output_SegmentsTest, Name )
+{
+	EXPECT_EQ( "model.seg", output_segments_name( "model.fmu" ) );
+	EXPECT_EQ( "achilles.seg", output_segments_name( "achilles" ) );
+}
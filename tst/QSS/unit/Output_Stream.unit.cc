@@ -0,0 +1,134 @@
+// QSS::Output_Stream Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Output_Stream.hh>
+
+#ifndef _WIN32
+
+// C++ Headers
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// POSIX Headers
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+// Read All Available Bytes from a Non-Blocking Descriptor into a Stream Reader
+void
+drain( int const fd, Output_Stream_Reader & reader )
+{
+	char buffer[ 4096 ];
+	::ssize_t n;
+	while ( ( n = ::read( fd, buffer, sizeof( buffer ) ) ) > 0 ) {
+		reader.append( buffer, std::size_t( n ) );
+	}
+}
+
+}
+
+TEST( Output_StreamTest, Socket )
+{
+	std::string const path( "Output_Stream.unit.sock" );
+	Output_Stream_Writer writer( path, 256u ); // Small batches
+	ASSERT_TRUE( writer.is_open() );
+	EXPECT_FALSE( writer.connected() );
+	EXPECT_EQ( 0u, writer.add( "x1", 'x' ) );
+	writer.put( 0u, 0.0, 1.0 );
+	writer.flush(); // No monitor yet: Dropped
+	EXPECT_EQ( 1u, writer.n_dropped() );
+
+	int const fd( ::socket( AF_UNIX, SOCK_STREAM, 0 ) );
+	ASSERT_GE( fd, 0 );
+	::sockaddr_un addr;
+	std::memset( &addr, 0, sizeof( addr ) );
+	addr.sun_family = AF_UNIX;
+	std::strcpy( addr.sun_path, path.c_str() );
+	ASSERT_EQ( 0, ::connect( fd, reinterpret_cast< ::sockaddr const * >( &addr ), sizeof( addr ) ) );
+	::fcntl( fd, F_SETFL, ::fcntl( fd, F_GETFL ) | O_NONBLOCK );
+
+	EXPECT_EQ( 1u, writer.add( "long_variable_name", 'q' ) );
+	for ( int i = 0; i < 100; ++i ) { // Several batches
+		writer.put( 0u, 0.1 * i, 2.0 * i );
+		writer.put( 1u, 0.1 * i, -3.0 * i );
+	}
+	writer.flush();
+	EXPECT_TRUE( writer.connected() );
+
+	Output_Stream_Reader reader;
+	drain( fd, reader );
+	Output_Stream_Reader::size_type c( 0u );
+	double t( 0.0 ), v( 0.0 );
+	for ( int i = 0; i < 100; ++i ) {
+		ASSERT_TRUE( reader.next( c, t, v ) );
+		EXPECT_EQ( 0u, c );
+		EXPECT_EQ( 0.1 * i, t );
+		EXPECT_EQ( 2.0 * i, v );
+		ASSERT_TRUE( reader.next( c, t, v ) );
+		EXPECT_EQ( 1u, c );
+		EXPECT_EQ( -3.0 * i, v );
+	}
+	EXPECT_FALSE( reader.next( c, t, v ) );
+	EXPECT_TRUE( reader.good() );
+	ASSERT_EQ( 2u, reader.size() );
+	EXPECT_EQ( "x1", reader.name( 0u ) );
+	EXPECT_EQ( "long_variable_name", reader.name( 1u ) );
+	EXPECT_EQ( 'q', reader.kind( 1u ) );
+
+	::close( fd ); // Monitor goes away: Writer must carry on
+	for ( int i = 0; i < 100; ++i ) writer.put( 0u, 1.0, 1.0 );
+	writer.flush();
+	writer.put( 0u, 1.0, 1.0 );
+	writer.flush();
+	EXPECT_FALSE( writer.connected() );
+	writer.close();
+	EXPECT_NE( 0, ::access( path.c_str(), F_OK ) ); // Socket removed
+}
+
+TEST( Output_StreamTest, FIFO )
+{
+	std::string const path( "Output_Stream.unit.fifo" );
+	std::remove( path.c_str() );
+	ASSERT_EQ( 0, ::mkfifo( path.c_str(), 0600 ) );
+	{
+		Output_Stream_Writer writer( path );
+		ASSERT_TRUE( writer.is_open() );
+		writer.add( "x", 'x' );
+		int const fd( ::open( path.c_str(), O_RDONLY | O_NONBLOCK ) );
+		ASSERT_GE( fd, 0 );
+		for ( int i = 0; i < 10; ++i ) writer.put( 0u, double( i ), double( i * i ) );
+		writer.close();
+		Output_Stream_Reader reader;
+		drain( fd, reader );
+		::close( fd );
+		Output_Stream_Reader::size_type c( 0u );
+		double t( 0.0 ), v( 0.0 );
+		for ( int i = 0; i < 10; ++i ) {
+			ASSERT_TRUE( reader.next( c, t, v ) );
+			EXPECT_EQ( double( i ), t );
+			EXPECT_EQ( double( i * i ), v );
+		}
+		EXPECT_FALSE( reader.next( c, t, v ) );
+	}
+	std::remove( path.c_str() );
+}
+
+#endif
+
+TEST( Output_StreamTest, ReaderBadPreamble )
+{
+	Output_Stream_Reader reader;
+	reader.append( "QSSX\1\0\0\0", 8u );
+	Output_Stream_Reader::size_type c( 0u );
+	double t( 0.0 ), v( 0.0 );
+	EXPECT_FALSE( reader.next( c, t, v ) );
+	EXPECT_FALSE( reader.good() );
+}
@@ -0,0 +1,76 @@
+// QSS::Parallel Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Parallel.hh>
+#include <QSS/Function_LTI.hh>
+#include <QSS/Pool.hh>
+#include <QSS/Variable_QSS2.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST( ParallelTest, ObserverAdvance )
+{
+	using V = Variable_QSS2< Function_LTI >;
+	std::size_t const n( 50u );
+	std::vector< std::unique_ptr< V > > s, p; // Serial and parallel models
+	for ( std::vector< std::unique_ptr< V > > * m : { &s, &p } ) {
+		m->emplace_back( new V( "x" ) );
+		V & x( *m->front() );
+		x.d().add( 1.0 ).add( -1.0, x );
+		for ( std::size_t i = 1; i <= n; ++i ) {
+			m->emplace_back( new V( "y" + std::to_string( i ) ) );
+			V & y( *m->back() );
+			y.d().add( 1.0 / double( i ), x ).add( -1.0, y );
+			if ( i > 1u ) y.d().add( 0.5, *( *m )[ i - 1u ] ); // Observers that observe each other advance concurrently
+		}
+		x.init( 0.0 );
+		for ( std::size_t i = 1; i <= n; ++i ) ( *m )[ i ]->init( 0.5 );
+	}
+	ASSERT_EQ( n, s.front()->observers().size() );
+
+	s.front()->advance(); // Serial observer advances
+	Pool workers( 3u );
+	parallel::pool = &workers;
+	std::size_t const par_fanout( options::par_fanout );
+	options::par_fanout = 1u;
+	p.front()->advance(); // Parallel observer advances
+	options::par_fanout = par_fanout;
+	parallel::pool = nullptr;
+
+	EXPECT_EQ( s.front()->tQ, p.front()->tQ );
+	for ( std::size_t i = 1; i <= n; ++i ) {
+		EXPECT_EQ( s.front()->tQ, p[ i ]->tX );
+		EXPECT_EQ( s[ i ]->tE, p[ i ]->tE );
+		EXPECT_EQ( s[ i ]->x( s[ i ]->tE ), p[ i ]->x( p[ i ]->tE ) );
+		EXPECT_EQ( s[ i ]->x1( s[ i ]->tE ), p[ i ]->x1( p[ i ]->tE ) );
+	}
+	events.clear();
+}
+
+TEST( ParallelTest, RepeatedObservers )
+{
+	using V = Variable_QSS2< Function_LTI >;
+	V x( "x" ), y( "y" ), z( "z" );
+	x.d().add( 1.0 ).add( -1.0, x );
+	y.d().add( 1.0, x ).add( -1.0, y );
+	z.d().add( 1.0, x ).add( 1.0, y ).add( -1.0, z );
+	x.init( 0.0 );
+	y.init( 0.5 );
+	z.init( 0.5 );
+	Variable::Time const t( std::min( { x.tE, y.tE, z.tE } ) * 0.5 );
+	Pool workers( 2u );
+	parallel::pool = &workers;
+	parallel::advance_observers( { &y, &z, &z, &y }, t ); // Batch observer list with repeats
+	parallel::pool = nullptr;
+	EXPECT_EQ( t, y.tX );
+	EXPECT_EQ( t, z.tX );
+	EXPECT_EQ( 3u, events.size() );
+	events.clear();
+}
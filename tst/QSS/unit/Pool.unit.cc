@@ -0,0 +1,28 @@
+// QSS::Pool Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Pool.hh>
+
+// C++ Headers
+#include <atomic>
+#include <vector>
+
+TEST( PoolTest, Run )
+{
+	Pool workers( 4u );
+	EXPECT_EQ( 4u, workers.size() );
+	std::vector< int > done( 4u, 0 );
+	std::atomic< int > n( 0 );
+	for ( int r = 0; r < 100; ++r ) {
+		workers.run( 4u, [&]( Pool::size_type const i ){ ++done[ i ]; ++n; } );
+	}
+	for ( int const d : done ) EXPECT_EQ( 100, d );
+	EXPECT_EQ( 400, n );
+	workers.run( 2u, [&]( Pool::size_type const i ){ ++done[ i ]; } ); // Fewer tasks than workers
+	EXPECT_EQ( 101, done[ 0 ] );
+	EXPECT_EQ( 101, done[ 1 ] );
+	EXPECT_EQ( 100, done[ 2 ] );
+}
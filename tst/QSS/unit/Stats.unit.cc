@@ -0,0 +1,63 @@
+// QSS::Stats Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Stats.hh>
+#include <QSS/Function_LTI.hh>
+#include <QSS/Variable_QSS1.hh>
+
+// C++ Headers
+#include <limits>
+#include <sstream>
+
+TEST( StatsTest, Steps )
+{
+	using size_type = Stats_Steps::size_type;
+	EXPECT_EQ( 0u, Stats_Steps::bin( 0.0 ) );
+	EXPECT_EQ( 0u, Stats_Steps::bin( 1.0e-12 ) );
+	EXPECT_EQ( 1u, Stats_Steps::bin( 1.0e-9 ) );
+	EXPECT_EQ( size_type( 9u ), Stats_Steps::bin( 0.5 ) ); // [1e-1,1e0)
+	EXPECT_EQ( size_type( 10u ), Stats_Steps::bin( 1.0 ) ); // [1e0,1e1)
+	EXPECT_EQ( Stats_Steps::n_bins - 2u, Stats_Steps::bin( 1.0e3 ) );
+	EXPECT_EQ( Stats_Steps::n_bins - 1u, Stats_Steps::bin( std::numeric_limits< double >::infinity() ) );
+}
+
+TEST( StatsTest, Requant )
+{
+	Variable_Stats s;
+	Variable_Stats::size_type const n_inf( Variable_Stats::steps.counts[ Stats_Steps::n_bins - 1u ] );
+	s.requant( 1.0, 1.5, false, 3u );
+	s.requant( 1.5, 1.75, true, 3u );
+	s.requant( 1.75, std::numeric_limits< double >::infinity(), false, 3u );
+	EXPECT_EQ( 3u, s.n_requant );
+	EXPECT_EQ( 1u, s.n_simultaneous );
+	EXPECT_EQ( 9u, s.n_fanout );
+	EXPECT_EQ( 2u, s.n_dt );
+	EXPECT_DOUBLE_EQ( 0.75, s.dt_sum );
+	EXPECT_DOUBLE_EQ( 0.25, s.dt_min );
+	EXPECT_EQ( n_inf + 1u, Variable_Stats::steps.counts[ Stats_Steps::n_bins - 1u ] );
+}
+
+#ifdef QSS_STATS
+TEST( StatsTest, Report )
+{
+	Variable_QSS1< Function_LTI > x( "x" ), y( "y" ), z( "z" );
+	x.i_var = 0u;
+	y.i_var = 1u;
+	z.i_var = 2u;
+	x.add_observer( y );
+	x.add_observer( z );
+	y.add_observer( z );
+	x.stats.requant( 0.0, 1.0, false, 2u );
+	x.stats.requant( 1.0, 2.0, false, 2u );
+	y.stats.requant( 0.0, 1.0, false, 1u );
+	std::ostringstream report;
+	stats_report( { &x, &y, &z }, 2u, report );
+	std::string const s( report.str() );
+	EXPECT_NE( std::string::npos, s.find( "3 self requantizations" ) );
+	EXPECT_NE( std::string::npos, s.find( "x -> y" ) ); // Hottest trigger: Tie broken by hotter observer
+	EXPECT_EQ( std::string::npos, s.find( "y -> z" ) ); // Not in top 2
+}
+#endif
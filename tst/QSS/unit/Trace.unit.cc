@@ -0,0 +1,96 @@
+// QSS::Trace Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Trace.hh>
+
+// C++ Headers
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+// File Contents
+std::string
+contents( std::string const & file_name )
+{
+	std::ifstream stream( file_name, std::ios_base::binary | std::ios_base::in );
+	std::ostringstream buffer;
+	buffer << stream.rdbuf();
+	return buffer.str();
+}
+
+// Count of Substring Occurrences
+std::size_t
+count( std::string const & s, std::string const & sub )
+{
+	std::size_t n( 0u );
+	for ( std::string::size_type i = s.find( sub ); i != std::string::npos; i = s.find( sub, i + 1u ) ) ++n;
+	return n;
+}
+
+}
+
+TEST( TraceTest, Off )
+{
+	EXPECT_FALSE( trace::on );
+	{
+		trace::Scope const scope( trace::Phase::Advance ); // No-op
+	}
+	EXPECT_FALSE( trace::stop() );
+	EXPECT_STREQ( "advance1", trace::name( trace::Phase::Advance1 ) );
+	EXPECT_STREQ( "fmu_event", trace::name( trace::Phase::FMU_Event ) );
+}
+
+TEST( TraceTest, JSON )
+{
+	std::string const file_name( "Trace.unit.json" );
+	trace::start( file_name );
+	EXPECT_TRUE( trace::on );
+	{
+		trace::Scope const scope( trace::Phase::Advance );
+		trace::Scope const inner( trace::Phase::Observers );
+	}
+	std::thread worker( [](){ trace::Scope const scope( trace::Phase::FMU_Get ); } );
+	worker.join();
+	ASSERT_TRUE( trace::stop() );
+	EXPECT_FALSE( trace::on );
+	std::string const json( contents( file_name ) );
+	EXPECT_EQ( 0u, json.find( "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" ) );
+	EXPECT_EQ( 2u, count( json, "\"thread_name\"" ) );
+	EXPECT_EQ( 1u, count( json, "\"name\":\"advance\"" ) );
+	EXPECT_EQ( 1u, count( json, "\"name\":\"observers\"" ) );
+	EXPECT_EQ( 1u, count( json, "\"name\":\"fmu_get\",\"cat\":\"qss\",\"ph\":\"X\",\"pid\":1,\"tid\":1" ) );
+	EXPECT_EQ( std::string( "\n]}\n" ), json.substr( json.length() - 4u ) );
+	std::remove( file_name.c_str() );
+}
+
+TEST( TraceTest, BinaryRing )
+{
+	std::string const file_name( "Trace.unit.qsst" );
+	std::string const json_name( "Trace.unit.json" );
+	trace::start( file_name, 3u ); // Rounded up to 4
+	for ( int i = 0; i < 6; ++i ) {
+		trace::Scope const scope( i < 2 ? trace::Phase::Queue_Top : trace::Phase::Queue_Shift );
+	}
+	ASSERT_TRUE( trace::stop() );
+	std::string const qsst( contents( file_name ) );
+	ASSERT_LT( 8u, qsst.length() );
+	std::uint32_t version( 0u );
+	std::memcpy( &version, qsst.data() + 4u, sizeof( version ) );
+	EXPECT_EQ( 2u, version ); // Separate begin time and phase|duration record words
+	ASSERT_TRUE( trace::trace_to_json( file_name ) );
+	std::string const json( contents( json_name ) );
+	EXPECT_EQ( 0u, count( json, "queue_top" ) ); // Oldest overwritten
+	EXPECT_EQ( 4u, count( json, "queue_shift" ) );
+	std::remove( file_name.c_str() );
+	std::remove( json_name.c_str() );
+	EXPECT_FALSE( trace::trace_to_json( file_name ) ); // Missing
+}
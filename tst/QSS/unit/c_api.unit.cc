@@ -0,0 +1,94 @@
+// QSS::c_api Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/c_api.h>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+TEST( c_apiTest, SimulateRepeated )
+{
+	char a_qss[] = "QSS";
+	char a_method[] = "--qss=QSS1";
+	char a_var[] = "--var=x";
+	char a_tEnd[] = "--tEnd=0.5";
+	char a_out_bad[] = "--out=w";
+	char a_model[] = "xyz";
+
+	// Options of the first call
+	char * argv1[] = { a_qss, a_method, a_var, a_tEnd, a_model };
+	qss_results * results1( qss_simulate( 5, argv1 ) );
+	ASSERT_TRUE( results1 != nullptr );
+	EXPECT_EQ( 1u, qss_results_channels( results1 ) ); // Only x selected
+	EXPECT_EQ( 'x', qss_results_kind( results1, 0u ) );
+	EXPECT_STREQ( "x", qss_results_name( results1, 0u ) );
+	size_t const n1( qss_results_size( results1, 0u ) );
+	EXPECT_LT( 1u, n1 );
+	EXPECT_EQ( 0.5, qss_results_times( results1, 0u )[ n1 - 1u ] );
+	qss_results_free( results1 );
+
+	// Invalid argument: Error return instead of exit
+	char * argv2[] = { a_qss, a_out_bad, a_model };
+	EXPECT_TRUE( qss_simulate( 3, argv2 ) == nullptr );
+
+	// Completed integrator step calls at sampled output times without sampled or FMU output
+	char a_cis[] = "--cis=0";
+	char a_out_r[] = "--out=rx";
+	char * argv_cis[] = { a_qss, a_cis, a_out_r, a_model };
+	EXPECT_TRUE( qss_simulate( 4, argv_cis ) == nullptr );
+
+	// Defaults restored: No variable selection or method carried over
+	char * argv3[] = { a_qss, a_model };
+	qss_results * results3( qss_simulate( 2, argv3 ) );
+	ASSERT_TRUE( results3 != nullptr );
+	EXPECT_EQ( options::QSS::QSS2, options::qss );
+	EXPECT_TRUE( options::var.empty() );
+	EXPECT_EQ( 3u, qss_results_channels( results3 ) ); // x, y, and z
+	EXPECT_EQ( qss_results_channels( results3 ), qss_results_find( results3, "w", 'x' ) );
+	size_t const i_y( qss_results_find( results3, "y", 'x' ) );
+	ASSERT_LT( i_y, qss_results_channels( results3 ) );
+	EXPECT_EQ( 1.0, qss_results_times( results3, i_y )[ qss_results_size( results3, i_y ) - 1u ] );
+	qss_results_free( results3 );
+	options::reset();
+}
+
+TEST( c_apiTest, SimulateFMUFailure )
+{
+	std::string const fmu_name( "c_api.unit.fmu" );
+	std::string const cache_dir( "c_api.unit.cache" );
+	char a_qss[] = "QSS";
+	char a_cache[] = "--cache=c_api.unit.cache";
+	char a_model[] = "c_api.unit.fmu";
+
+	// Unreadable FMU file: Error return before unpacking
+	std::remove( fmu_name.c_str() );
+	char * argv1[] = { a_qss, a_cache, a_model };
+	EXPECT_TRUE( qss_simulate( 3, argv1 ) == nullptr );
+
+	// Not an FMI 2.0 FMU: Error return with the cache staging directory removed
+	{
+		std::ofstream fmu_file( fmu_name, std::ios_base::binary | std::ios_base::out );
+		fmu_file << "Not a zip file";
+	}
+	EXPECT_TRUE( qss_simulate( 3, argv1 ) == nullptr );
+	EXPECT_TRUE( qss_simulate( 3, argv1 ) == nullptr ); // Repeatable
+#ifndef _WIN32
+	EXPECT_EQ( 0, std::remove( cache_dir.c_str() ) ); // Only an empty directory can be removed
+#endif
+	std::remove( fmu_name.c_str() );
+
+	// Example model runs after the failures
+	char a_model_ex[] = "xyz";
+	char * argv2[] = { a_qss, a_model_ex };
+	qss_results * results( qss_simulate( 2, argv2 ) );
+	ASSERT_TRUE( results != nullptr );
+	EXPECT_EQ( 3u, qss_results_channels( results ) );
+	qss_results_free( results );
+	options::reset();
+}
@@ -0,0 +1,110 @@
+// QSS::ex_synthetic Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/ex_synthetic.hh>
+#include <QSS/Function_LTI.hh>
+#include <QSS/Variable_QSS.hh>
+
+// C++ Headers
+#include <string>
+
+namespace {
+
+using V = Variable_QSS< Function_LTI >;
+
+// Derivative of Variable i at Initial Values
+double
+d0( ex::Variables const & vars, std::size_t const i )
+{
+	return static_cast< V * >( vars[ i ] )->d().x( 0.0 );
+}
+
+// Delete Variables
+void
+clear( ex::Variables & vars )
+{
+	for ( auto var : vars ) delete var;
+	vars.clear();
+}
+
+}
+
+TEST( ex_syntheticTest, Spec )
+{
+	EXPECT_TRUE( ex::is_synthetic( "grid3d:100x100x10" ) );
+	EXPECT_TRUE( ex::is_synthetic( "graph:10,fanout=2" ) );
+	EXPECT_FALSE( ex::is_synthetic( "grid3d" ) );
+	EXPECT_FALSE( ex::is_synthetic( "xyz" ) );
+	EXPECT_FALSE( ex::is_synthetic( "model.fmu" ) );
+}
+
+TEST( ex_syntheticTest, Chain )
+{
+	ex::Variables vars;
+	ex::synthetic( "chain:3,coupling=2", vars );
+	ASSERT_EQ( 3u, vars.size() );
+	EXPECT_EQ( "x1", vars[ 0 ]->name );
+	EXPECT_EQ( "x3", vars[ 2 ]->name );
+	double const x0( vars[ 0 ]->xIni ), x1( vars[ 1 ]->xIni ), x2( vars[ 2 ]->xIni );
+	EXPECT_DOUBLE_EQ( 1.0 - x0 + 2.0 * ( x1 - x0 ), d0( vars, 0u ) ); // Source, decay, one neighbor
+	EXPECT_DOUBLE_EQ( -x1 + 2.0 * ( x0 - x1 ) + 2.0 * ( x2 - x1 ), d0( vars, 1u ) );
+	clear( vars );
+}
+
+TEST( ex_syntheticTest, Grid )
+{
+	ex::Variables vars;
+	ex::synthetic( "grid3d:4x3x2", vars );
+	ASSERT_EQ( 24u, vars.size() );
+	EXPECT_EQ( "x_1_1_1", vars[ 0 ]->name );
+	EXPECT_EQ( "x_2_1_1", vars[ 1 ]->name );
+	EXPECT_EQ( "x_1_2_1", vars[ 4 ]->name );
+	EXPECT_EQ( "x_4_3_2", vars[ 23 ]->name );
+	clear( vars );
+	ex::synthetic( "grid2d:5x5", vars );
+	ASSERT_EQ( 25u, vars.size() );
+	double const c( vars[ 12 ]->xIni ); // Center: 4 neighbors
+	double const lap( vars[ 11 ]->xIni + vars[ 13 ]->xIni + vars[ 7 ]->xIni + vars[ 17 ]->xIni - 4.0 * c );
+	EXPECT_NEAR( -c + lap, d0( vars, 12u ), 1.0e-14 );
+	clear( vars );
+}
+
+TEST( ex_syntheticTest, GraphAndBlocks )
+{
+	ex::Variables vars;
+	ex::synthetic( "graph:50,fanout=3,seed=7", vars );
+	ASSERT_EQ( 50u, vars.size() );
+	ex::Variables vars2;
+	ex::synthetic( "graph:50,fanout=3,seed=7", vars2 ); // Reproducible
+	for ( std::size_t i = 0; i < 50u; ++i ) EXPECT_EQ( d0( vars, i ), d0( vars2, i ) );
+	clear( vars );
+	clear( vars2 );
+	ex::synthetic( "blocks:3x4,stiffness=100", vars );
+	ASSERT_EQ( 12u, vars.size() );
+	EXPECT_EQ( "b1_x1", vars[ 0 ]->name );
+	EXPECT_EQ( "b3_x4", vars[ 11 ]->name );
+	clear( vars );
+}
+
+TEST( ex_syntheticTest, Sync )
+{
+	ex::Variables vars;
+	ex::synthetic( "sync:4x10,fanout=2", vars );
+	ASSERT_EQ( 14u, vars.size() );
+	EXPECT_EQ( "s1", vars[ 0 ]->name );
+	EXPECT_EQ( "s4", vars[ 3 ]->name );
+	EXPECT_EQ( "y1", vars[ 4 ]->name );
+	EXPECT_EQ( "y10", vars[ 13 ]->name );
+	for ( std::size_t i = 0; i < 4u; ++i ) {
+		EXPECT_EQ( 0.0, vars[ i ]->xIni );
+		EXPECT_DOUBLE_EQ( 1.0, d0( vars, i ) ); // Identical sources
+	}
+	for ( std::size_t i = 4u; i < 14u; ++i ) static_cast< V * >( vars[ i ] )->d().finalize( vars[ i ] ); // Register observers
+	std::size_t n_edges( 0u );
+	for ( std::size_t i = 0; i < 4u; ++i ) n_edges += vars[ i ]->observers().size();
+	EXPECT_EQ( 20u, n_edges ); // Each observer depends on fanout distinct sources
+	clear( vars );
+}